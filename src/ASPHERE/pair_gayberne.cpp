@@ -53,6 +53,9 @@ PairGayBerne::PairGayBerne(LAMMPS *lmp) : Pair(lmp)
 
   single_enable = 0;
   writedata = 1;
+
+  amat = bmat = gmat = NULL;
+  nmax_cache = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -80,6 +83,10 @@ PairGayBerne::~PairGayBerne()
     delete [] lshape;
     delete [] setwell;
   }
+
+  memory->destroy(amat);
+  memory->destroy(bmat);
+  memory->destroy(gmat);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -89,9 +96,13 @@ void PairGayBerne::compute(int eflag, int vflag)
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double evdwl,one_eng,rsq,r2inv,r6inv,forcelj,factor_lj;
   double fforce[3],ttor[3],rtor[3],r12[3];
-  double a1[3][3],b1[3][3],g1[3][3],a2[3][3],b2[3][3],g2[3][3],temp[3][3];
+  double temp[3][3];
+  double (*a1)[3] = NULL;
+  double (*b1)[3] = NULL;
+  double (*g1)[3] = NULL;
+  double (*a2)[3],(*b2)[3],(*g2)[3];
   int *ilist,*jlist,*numneigh,**firstneigh;
-  double *iquat,*jquat;
+  double *iquat;
 
   evdwl = 0.0;
   if (eflag || vflag) ev_setup(eflag,vflag);
@@ -112,6 +123,38 @@ void PairGayBerne::compute(int eflag, int vflag)
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
+  // cache the orientation-dependent matrices of each ellipsoidal atom:
+  //   a = transposed rotation matrix from the quaternion
+  //   b = a' * well * a, g = a' * shape2 * a
+  // each atom appears in many pairs, so filling the cache once per step
+  //   replaces the redundant quaternion math in the neighbor loop below
+
+  int nall = nlocal + atom->nghost;
+
+  if (atom->nmax > nmax_cache) {
+    memory->destroy(amat);
+    memory->destroy(bmat);
+    memory->destroy(gmat);
+    nmax_cache = atom->nmax;
+    memory->create(amat,nmax_cache,9,"pair:amat");
+    memory->create(bmat,nmax_cache,9,"pair:bmat");
+    memory->create(gmat,nmax_cache,9,"pair:gmat");
+  }
+
+  for (i = 0; i < nall; i++) {
+    itype = type[i];
+    if (form[itype][itype] != ELLIPSE_ELLIPSE) continue;
+    a1 = (double (*)[3]) amat[i];
+    b1 = (double (*)[3]) bmat[i];
+    g1 = (double (*)[3]) gmat[i];
+    iquat = bonus[ellipsoid[i]].quat;
+    MathExtra::quat_to_mat_trans(iquat,a1);
+    MathExtra::diag_times3(well[itype],a1,temp);
+    MathExtra::transpose_times3(a1,temp,b1);
+    MathExtra::diag_times3(shape2[itype],a1,temp);
+    MathExtra::transpose_times3(a1,temp,g1);
+  }
+
   // loop over neighbors of my atoms
 
   for (ii = 0; ii < inum; ii++) {
@@ -119,12 +162,9 @@ void PairGayBerne::compute(int eflag, int vflag)
     itype = type[i];
 
     if (form[itype][itype] == ELLIPSE_ELLIPSE) {
-      iquat = bonus[ellipsoid[i]].quat;
-      MathExtra::quat_to_mat_trans(iquat,a1);
-      MathExtra::diag_times3(well[itype],a1,temp);
-      MathExtra::transpose_times3(a1,temp,b1);
-      MathExtra::diag_times3(shape2[itype],a1,temp);
-      MathExtra::transpose_times3(a1,temp,g1);
+      a1 = (double (*)[3]) amat[i];
+      b1 = (double (*)[3]) bmat[i];
+      g1 = (double (*)[3]) gmat[i];
     }
 
     jlist = firstneigh[i];
@@ -164,12 +204,9 @@ void PairGayBerne::compute(int eflag, int vflag)
           break;
 
         case SPHERE_ELLIPSE:
-          jquat = bonus[ellipsoid[j]].quat;
-          MathExtra::quat_to_mat_trans(jquat,a2);
-          MathExtra::diag_times3(well[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,b2);
-          MathExtra::diag_times3(shape2[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,g2);
+          a2 = (double (*)[3]) amat[j];
+          b2 = (double (*)[3]) bmat[j];
+          g2 = (double (*)[3]) gmat[j];
           one_eng = gayberne_lj(j,i,a2,b2,g2,r12,rsq,fforce,rtor);
           ttor[0] = ttor[1] = ttor[2] = 0.0;
           break;
@@ -180,12 +217,9 @@ void PairGayBerne::compute(int eflag, int vflag)
           break;
 
         default:
-          jquat = bonus[ellipsoid[j]].quat;
-          MathExtra::quat_to_mat_trans(jquat,a2);
-          MathExtra::diag_times3(well[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,b2);
-          MathExtra::diag_times3(shape2[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,g2);
+          a2 = (double (*)[3]) amat[j];
+          b2 = (double (*)[3]) bmat[j];
+          g2 = (double (*)[3]) gmat[j];
           one_eng = gayberne_analytic(i,j,a1,a2,b1,b2,g1,g2,r12,rsq,
                                       fforce,ttor,rtor);
           break;
@@ -59,6 +59,10 @@ class PairGayBerne : public Pair {
   int *setwell;
   class AtomVecEllipsoid *avec;
 
+  double **amat,**bmat,**gmat;  // cached per-atom orientation matrices
+                                // (flattened 3x3), filled once per compute()
+  int nmax_cache;               // allocated rows in the cache
+
   void allocate();
   double gayberne_analytic(const int i, const int j, double a1[3][3],
                            double a2[3][3], double b1[3][3], double b2[3][3],
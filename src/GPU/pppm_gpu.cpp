@@ -94,6 +94,10 @@ PPPMGPU::PPPMGPU(LAMMPS *lmp, int narg, char **arg) : PPPM(lmp, narg, arg)
   if (narg != 1) error->all(FLERR,"Illegal kspace_style pppm/gpu command");
 
   triclinic_support = 0;
+
+  // forces are returned from the device into atom->f, cannot overlap
+
+  pipeline_capable = 0;
   density_brick_gpu = vd_brick = NULL;
   kspace_split = false;
   im_real_space = false;
@@ -37,7 +37,19 @@
 
 using namespace LAMMPS_NS;
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   base class for granular contact laws
+   variants compose the same way the fix nve/nvt/npt family does: a
+     small subclass sets its flags in the constructor and overrides
+     compute() and single() with its own contact kernel, reusing all
+     the history, shear-comm, and fix rigid plumbing here
+   see pair gran/hertz/history for the pattern: a new normal or
+     tangential law, e.g. one adding rolling friction, is one file
+     with one specialized loop, not a template instantiation
+   each kernel is written out straight-line on purpose: it keeps every
+     combination independently readable and profilable, and matches
+     how the rest of the pair styles in this tree are organized
+------------------------------------------------------------------------- */
 
 PairGranHookeHistory::PairGranHookeHistory(LAMMPS *lmp) : Pair(lmp)
 {
@@ -69,6 +69,10 @@ PPPMKokkos<DeviceType>::PPPMKokkos(LAMMPS *lmp, int narg, char **arg) : PPPM(lmp
   if (narg < 1) error->all(FLERR,"Illegal kspace_style pppm command");
 
   atomKK = (AtomKokkos *) atom;
+
+  // fieldforce writes directly to atom->f, cannot overlap with pair
+
+  pipeline_capable = 0;
   execution_space = ExecutionSpaceFromDevice<DeviceType>::space;
   datamask_read = X_MASK | F_MASK | TYPE_MASK | Q_MASK;
   datamask_modify = F_MASK;
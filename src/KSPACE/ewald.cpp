@@ -43,7 +43,7 @@ using namespace MathConst;
 Ewald::Ewald(LAMMPS *lmp, int narg, char **arg) : KSpace(lmp, narg, arg),
   kxvecs(NULL), kyvecs(NULL), kzvecs(NULL), ug(NULL), eg(NULL), vg(NULL),
   ek(NULL), sfacrl(NULL), sfacim(NULL), sfacrl_all(NULL), sfacim_all(NULL),
-  cs(NULL), sn(NULL), sfacrl_A(NULL), sfacim_A(NULL), sfacrl_A_all(NULL),
+  sfac2(NULL), sfac2_all(NULL), cs(NULL), sn(NULL), sfacrl_A(NULL), sfacim_A(NULL), sfacrl_A_all(NULL),
   sfacim_A_all(NULL), sfacrl_B(NULL), sfacim_B(NULL), sfacrl_B_all(NULL),
   sfacim_B_all(NULL)
 {
@@ -61,6 +61,7 @@ Ewald::Ewald(LAMMPS *lmp, int narg, char **arg) : KSpace(lmp, narg, arg),
   ug = NULL;
   eg = vg = NULL;
   sfacrl = sfacim = sfacrl_all = sfacim_all = NULL;
+  sfac2 = sfac2_all = NULL;
 
   nmax = 0;
   ek = NULL;
@@ -396,8 +397,20 @@ void Ewald::compute(int eflag, int vflag)
   else
     eik_dot_r_triclinic();
 
-  MPI_Allreduce(sfacrl,sfacrl_all,kcount,MPI_DOUBLE,MPI_SUM,world);
-  MPI_Allreduce(sfacim,sfacim_all,kcount,MPI_DOUBLE,MPI_SUM,world);
+  // pack real and imaginary parts into one buffer
+  // so a single Allreduce sums both
+
+  for (k = 0; k < kcount; k++) {
+    sfac2[k] = sfacrl[k];
+    sfac2[kcount+k] = sfacim[k];
+  }
+
+  MPI_Allreduce(sfac2,sfac2_all,2*kcount,MPI_DOUBLE,MPI_SUM,world);
+
+  for (k = 0; k < kcount; k++) {
+    sfacrl_all[k] = sfac2_all[k];
+    sfacim_all[k] = sfac2_all[kcount+k];
+  }
 
   // K-space portion of electric field
   // double loop over K-vectors and local atoms
@@ -1144,6 +1157,8 @@ void Ewald::allocate()
   sfacim = new double[kmax3d];
   sfacrl_all = new double[kmax3d];
   sfacim_all = new double[kmax3d];
+  sfac2 = new double[2*kmax3d];
+  sfac2_all = new double[2*kmax3d];
 }
 
 /* ----------------------------------------------------------------------
@@ -1164,6 +1179,8 @@ void Ewald::deallocate()
   delete [] sfacim;
   delete [] sfacrl_all;
   delete [] sfacim_all;
+  delete [] sfac2;
+  delete [] sfac2_all;
 }
 
 /* ----------------------------------------------------------------------
@@ -1240,6 +1257,7 @@ double Ewald::memory_usage()
   double bytes = 3 * kmax3d * sizeof(int);
   bytes += (1 + 3 + 6) * kmax3d * sizeof(double);
   bytes += 4 * kmax3d * sizeof(double);
+  bytes += 2 * 2*kmax3d * sizeof(double);
   bytes += nmax*3 * sizeof(double);
   bytes += 2 * (2*kmax+1)*3*nmax * sizeof(double);
   return bytes;
@@ -1334,12 +1352,31 @@ void Ewald::compute_group_group(int groupbit_A, int groupbit_B, int AA_flag)
   }
 
   // total structure factor by summing over procs
+  // one fused Allreduce per group, as in compute()
+
+  for (k = 0; k < kcount; k++) {
+    sfac2[k] = sfacrl_A[k];
+    sfac2[kcount+k] = sfacim_A[k];
+  }
 
-  MPI_Allreduce(sfacrl_A,sfacrl_A_all,kcount,MPI_DOUBLE,MPI_SUM,world);
-  MPI_Allreduce(sfacim_A,sfacim_A_all,kcount,MPI_DOUBLE,MPI_SUM,world);
+  MPI_Allreduce(sfac2,sfac2_all,2*kcount,MPI_DOUBLE,MPI_SUM,world);
 
-  MPI_Allreduce(sfacrl_B,sfacrl_B_all,kcount,MPI_DOUBLE,MPI_SUM,world);
-  MPI_Allreduce(sfacim_B,sfacim_B_all,kcount,MPI_DOUBLE,MPI_SUM,world);
+  for (k = 0; k < kcount; k++) {
+    sfacrl_A_all[k] = sfac2_all[k];
+    sfacim_A_all[k] = sfac2_all[kcount+k];
+  }
+
+  for (k = 0; k < kcount; k++) {
+    sfac2[k] = sfacrl_B[k];
+    sfac2[kcount+k] = sfacim_B[k];
+  }
+
+  MPI_Allreduce(sfac2,sfac2_all,2*kcount,MPI_DOUBLE,MPI_SUM,world);
+
+  for (k = 0; k < kcount; k++) {
+    sfacrl_B_all[k] = sfac2_all[k];
+    sfacim_B_all[k] = sfac2_all[kcount+k];
+  }
 
   const double qscale = qqrd2e * scale;
   double partial_group;
@@ -48,6 +48,7 @@ class Ewald : public KSpace {
   double **eg,**vg;
   double **ek;
   double *sfacrl,*sfacim,*sfacrl_all,*sfacim_all;
+  double *sfac2,*sfac2_all;
   double ***cs,***sn;
 
   // group-group interactions
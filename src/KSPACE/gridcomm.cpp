@@ -485,6 +485,12 @@ void GridComm::setup()
 
 /* ----------------------------------------------------------------------
    use swap list in forward order to acquire copy of all needed ghost grid pts
+   swaps are ordered and cannot be issued concurrently: a later swap may
+     pack grid pts that were unpacked by an earlier swap, which is how
+     edge/corner ghosts propagate without extra diagonal messages
+   aggregation happens across values, not messages: nforward values per
+     grid pt travel in one buffer, e.g. all field components of ik
+     differentiation or all 7 dispersion terms of arithmetic mixing
 ------------------------------------------------------------------------- */
 
 void GridComm::forward_comm(KSpace *kspace, int which)
@@ -519,6 +519,14 @@ void MSM::compute(int eflag, int vflag)
 
   // forward communicate charge density values to fill ghost grid points
   // compute direct sum interaction and then restrict to coarser grid
+  // the V-cycle is a strict dependency chain: each level's forward_comm
+  //   needs the charge restricted from the level below, and each
+  //   prolongation needs the energy reverse-communicated from the level
+  //   above, so level exchanges can neither merge nor overlap with
+  //   another level's compute while GridComm is blocking
+  // the per-level exposed latency shrinks with grid size, the coarse
+  //   levels are cheap; threading of the direct sum, which dominates the
+  //   compute side, is provided by msm/omp in USER-OMP
 
   for (int n=0; n<=levels-2; n++) {
     if (!active_flag[n]) continue;
@@ -2916,7 +2924,7 @@ void MSM::compute_phis_and_dphis(const double &dx, const double &dy,
 
 /* ----------------------------------------------------------------------
    compute phi using interpolating polynomial
-   see Eq 7 from Parallel Computing 35 (2009) 164�177
+   see Eq 7 from Parallel Computing 35 (2009) 164�177
    and Hardy's thesis
 ------------------------------------------------------------------------- */
 
@@ -2995,7 +3003,7 @@ inline double MSM::compute_phi(const double &xi)
 /* ----------------------------------------------------------------------
    compute the derivative of phi
    phi is an interpolating polynomial
-   see Eq 7 from Parallel Computing 35 (2009) 164�177
+   see Eq 7 from Parallel Computing 35 (2009) 164�177
    and Hardy's thesis
 ------------------------------------------------------------------------- */
 
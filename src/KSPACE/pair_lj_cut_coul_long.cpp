@@ -54,12 +54,21 @@ PairLJCutCoulLong::PairLJCutCoulLong(LAMMPS *lmp) : Pair(lmp)
   writedata = 1;
   ftable = NULL;
   qdist = 0.0;
+
+#ifdef LMP_MIXED_PREC
+  x_single = NULL;
+  nmax_single = 0;
+#endif
 }
 
 /* ---------------------------------------------------------------------- */
 
 PairLJCutCoulLong::~PairLJCutCoulLong()
 {
+#ifdef LMP_MIXED_PREC
+  memory->destroy(x_single);
+#endif
+
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
@@ -80,6 +89,33 @@ PairLJCutCoulLong::~PairLJCutCoulLong()
 /* ---------------------------------------------------------------------- */
 
 void PairLJCutCoulLong::compute(int eflag, int vflag)
+{
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else evflag = vflag_fdotr = 0;
+
+  // select a compile-time specialized kernel so the inner loop
+  //   carries no eflag/vflag/newton branches
+
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1>();
+      else eval<1,1,0>();
+    } else {
+      if (force->newton_pair) eval<1,0,1>();
+      else eval<1,0,0>();
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1>();
+    else eval<0,0,0>();
+  }
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+void PairLJCutCoulLong::eval()
 {
   int i,ii,j,jj,inum,jnum,itype,jtype,itable;
   double qtmp,xtmp,ytmp,ztmp,delx,dely,delz,evdwl,ecoul,fpair;
@@ -90,8 +126,6 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
   double rsq;
 
   evdwl = ecoul = 0.0;
-  if (eflag || vflag) ev_setup(eflag,vflag);
-  else evflag = vflag_fdotr = 0;
 
   double **x = atom->x;
   double **f = atom->f;
@@ -100,7 +134,6 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
   int nlocal = atom->nlocal;
   double *special_coul = force->special_coul;
   double *special_lj = force->special_lj;
-  int newton_pair = force->newton_pair;
   double qqrd2e = force->qqrd2e;
 
   inum = list->inum;
@@ -108,14 +141,35 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
+#ifdef LMP_MIXED_PREC
+
+  // refresh single-precision copy of coords, read many times below
+  // halves coord read bandwidth, force accumulation remains double
+
+  int nall = nlocal + atom->nghost;
+  if (atom->nmax > nmax_single) {
+    memory->destroy(x_single);
+    nmax_single = atom->nmax;
+    memory->create(x_single,nmax_single,3,"pair:x_single");
+  }
+  for (i = 0; i < nall; i++) {
+    x_single[i][0] = (float) x[i][0];
+    x_single[i][1] = (float) x[i][1];
+    x_single[i][2] = (float) x[i][2];
+  }
+  float * const *xc = x_single;
+#else
+  double * const *xc = x;
+#endif
+
   // loop over neighbors of my atoms
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     qtmp = q[i];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
+    xtmp = xc[i][0];
+    ytmp = xc[i][1];
+    ztmp = xc[i][2];
     itype = type[i];
     jlist = firstneigh[i];
     jnum = numneigh[i];
@@ -126,9 +180,9 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
       factor_coul = special_coul[sbmask(j)];
       j &= NEIGHMASK;
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
+      delx = xtmp - xc[j][0];
+      dely = ytmp - xc[j][1];
+      delz = ztmp - xc[j][2];
       rsq = delx*delx + dely*dely + delz*delz;
       jtype = type[j];
 
@@ -171,13 +225,13 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
         f[i][0] += delx*fpair;
         f[i][1] += dely*fpair;
         f[i][2] += delz*fpair;
-        if (newton_pair || j < nlocal) {
+        if (NEWTON_PAIR || j < nlocal) {
           f[j][0] -= delx*fpair;
           f[j][1] -= dely*fpair;
           f[j][2] -= delz*fpair;
         }
 
-        if (eflag) {
+        if (EFLAG) {
           if (rsq < cut_coulsq) {
             if (!ncoultablebits || rsq <= tabinnersq)
               ecoul = prefactor*erfc;
@@ -195,13 +249,11 @@ void PairLJCutCoulLong::compute(int eflag, int vflag)
           } else evdwl = 0.0;
         }
 
-        if (evflag) ev_tally(i,j,nlocal,newton_pair,
+        if (EVFLAG) ev_tally(i,j,nlocal,NEWTON_PAIR,
                              evdwl,ecoul,fpair,delx,dely,delz);
       }
     }
   }
-
-  if (vflag_fdotr) virial_fdotr_compute();
 }
 
 /* ---------------------------------------------------------------------- */
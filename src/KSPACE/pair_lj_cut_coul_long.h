@@ -57,7 +57,15 @@ class PairLJCutCoulLong : public Pair {
   double qdist;             // TIP4P distance from O site to negative charge
   double g_ewald;
 
+#ifdef LMP_MIXED_PREC
+  float **x_single;         // single-precision copy of atom coords
+  int nmax_single;
+#endif
+
   virtual void allocate();
+
+ private:
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void eval();
 };
 
 }
@@ -61,6 +61,7 @@ PairLJCutTIP4PLong::PairLJCutTIP4PLong(LAMMPS *lmp) :
   nmax = 0;
   hneigh = NULL;
   newsite = NULL;
+  fmsite = NULL;
 
   // TIP4P cannot compute virial as F dot r
   // due to finding bonded H atoms which are not near O atom
@@ -74,6 +75,7 @@ PairLJCutTIP4PLong::~PairLJCutTIP4PLong()
 {
   memory->destroy(hneigh);
   memory->destroy(newsite);
+  memory->destroy(fmsite);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -110,11 +112,20 @@ void PairLJCutTIP4PLong::compute(int eflag, int vflag)
     memory->create(hneigh,nmax,3,"pair:hneigh");
     memory->destroy(newsite);
     memory->create(newsite,nmax,3,"pair:newsite");
+    memory->destroy(fmsite);
+    memory->create(fmsite,nmax,3,"pair:fmsite");
   }
   if (neighbor->ago == 0)
     for (i = 0; i < nall; i++) hneigh[i][0] = -1;
   for (i = 0; i < nall; i++) hneigh[i][2] = 0;
 
+  // on non-tally steps M-site forces are accumulated in fmsite and
+  //   partitioned to O,H atoms in a single post-pass after the loop
+
+  if (!evflag)
+    for (i = 0; i < nall; i++)
+      fmsite[i][0] = fmsite[i][1] = fmsite[i][2] = 0.0;
+
   double **f = atom->f;
   double **x = atom->x;
   double *q = atom->q;
@@ -318,39 +329,49 @@ void PairLJCutTIP4PLong::compute(int eflag, int vflag)
             fd[1] = dely*cforce;
             fd[2] = delz*cforce;
 
-            fO[0] = fd[0]*(1 - alpha);
-            fO[1] = fd[1]*(1 - alpha);
-            fO[2] = fd[2]*(1 - alpha);
-
-            fH[0] = 0.5 * alpha * fd[0];
-            fH[1] = 0.5 * alpha * fd[1];
-            fH[2] = 0.5 * alpha * fd[2];
-
-            f[i][0] += fO[0];
-            f[i][1] += fO[1];
-            f[i][2] += fO[2];
-
-            f[iH1][0] += fH[0];
-            f[iH1][1] += fH[1];
-            f[iH1][2] += fH[2];
+            // on non-tally steps just accumulate the M-site force,
+            //   partitioning to O,H happens once in the post-pass
 
-            f[iH2][0] += fH[0];
-            f[iH2][1] += fH[1];
-            f[iH2][2] += fH[2];
+            if (!evflag) {
+              fmsite[i][0] += fd[0];
+              fmsite[i][1] += fd[1];
+              fmsite[i][2] += fd[2];
 
-            if (vflag) {
-              xH1 = x[iH1];
-              xH2 = x[iH2];
-              v[0] = x[i][0]*fO[0] + xH1[0]*fH[0] + xH2[0]*fH[0];
-              v[1] = x[i][1]*fO[1] + xH1[1]*fH[1] + xH2[1]*fH[1];
-              v[2] = x[i][2]*fO[2] + xH1[2]*fH[2] + xH2[2]*fH[2];
-              v[3] = x[i][0]*fO[1] + xH1[0]*fH[1] + xH2[0]*fH[1];
-              v[4] = x[i][0]*fO[2] + xH1[0]*fH[2] + xH2[0]*fH[2];
-              v[5] = x[i][1]*fO[2] + xH1[1]*fH[2] + xH2[1]*fH[2];
+            } else {
+              fO[0] = fd[0]*(1 - alpha);
+              fO[1] = fd[1]*(1 - alpha);
+              fO[2] = fd[2]*(1 - alpha);
+
+              fH[0] = 0.5 * alpha * fd[0];
+              fH[1] = 0.5 * alpha * fd[1];
+              fH[2] = 0.5 * alpha * fd[2];
+
+              f[i][0] += fO[0];
+              f[i][1] += fO[1];
+              f[i][2] += fO[2];
+
+              f[iH1][0] += fH[0];
+              f[iH1][1] += fH[1];
+              f[iH1][2] += fH[2];
+
+              f[iH2][0] += fH[0];
+              f[iH2][1] += fH[1];
+              f[iH2][2] += fH[2];
+
+              if (vflag) {
+                xH1 = x[iH1];
+                xH2 = x[iH2];
+                v[0] = x[i][0]*fO[0] + xH1[0]*fH[0] + xH2[0]*fH[0];
+                v[1] = x[i][1]*fO[1] + xH1[1]*fH[1] + xH2[1]*fH[1];
+                v[2] = x[i][2]*fO[2] + xH1[2]*fH[2] + xH2[2]*fH[2];
+                v[3] = x[i][0]*fO[1] + xH1[0]*fH[1] + xH2[0]*fH[1];
+                v[4] = x[i][0]*fO[2] + xH1[0]*fH[2] + xH2[0]*fH[2];
+                v[5] = x[i][1]*fO[2] + xH1[1]*fH[2] + xH2[1]*fH[2];
+              }
+              vlist[n++] = i;
+              vlist[n++] = iH1;
+              vlist[n++] = iH2;
             }
-            vlist[n++] = i;
-            vlist[n++] = iH1;
-            vlist[n++] = iH2;
           }
 
           if (jtype != typeO) {
@@ -375,39 +396,46 @@ void PairLJCutTIP4PLong::compute(int eflag, int vflag)
             fd[1] = -dely*cforce;
             fd[2] = -delz*cforce;
 
-            fO[0] = fd[0]*(1 - alpha);
-            fO[1] = fd[1]*(1 - alpha);
-            fO[2] = fd[2]*(1 - alpha);
-
-            fH[0] = 0.5 * alpha * fd[0];
-            fH[1] = 0.5 * alpha * fd[1];
-            fH[2] = 0.5 * alpha * fd[2];
+            if (!evflag) {
+              fmsite[j][0] += fd[0];
+              fmsite[j][1] += fd[1];
+              fmsite[j][2] += fd[2];
 
-            f[j][0] += fO[0];
-            f[j][1] += fO[1];
-            f[j][2] += fO[2];
-
-            f[jH1][0] += fH[0];
-            f[jH1][1] += fH[1];
-            f[jH1][2] += fH[2];
-
-            f[jH2][0] += fH[0];
-            f[jH2][1] += fH[1];
-            f[jH2][2] += fH[2];
-
-            if (vflag) {
-              xH1 = x[jH1];
-              xH2 = x[jH2];
-              v[0] += x[j][0]*fO[0] + xH1[0]*fH[0] + xH2[0]*fH[0];
-              v[1] += x[j][1]*fO[1] + xH1[1]*fH[1] + xH2[1]*fH[1];
-              v[2] += x[j][2]*fO[2] + xH1[2]*fH[2] + xH2[2]*fH[2];
-              v[3] += x[j][0]*fO[1] + xH1[0]*fH[1] + xH2[0]*fH[1];
-              v[4] += x[j][0]*fO[2] + xH1[0]*fH[2] + xH2[0]*fH[2];
-              v[5] += x[j][1]*fO[2] + xH1[1]*fH[2] + xH2[1]*fH[2];
+            } else {
+              fO[0] = fd[0]*(1 - alpha);
+              fO[1] = fd[1]*(1 - alpha);
+              fO[2] = fd[2]*(1 - alpha);
+
+              fH[0] = 0.5 * alpha * fd[0];
+              fH[1] = 0.5 * alpha * fd[1];
+              fH[2] = 0.5 * alpha * fd[2];
+
+              f[j][0] += fO[0];
+              f[j][1] += fO[1];
+              f[j][2] += fO[2];
+
+              f[jH1][0] += fH[0];
+              f[jH1][1] += fH[1];
+              f[jH1][2] += fH[2];
+
+              f[jH2][0] += fH[0];
+              f[jH2][1] += fH[1];
+              f[jH2][2] += fH[2];
+
+              if (vflag) {
+                xH1 = x[jH1];
+                xH2 = x[jH2];
+                v[0] += x[j][0]*fO[0] + xH1[0]*fH[0] + xH2[0]*fH[0];
+                v[1] += x[j][1]*fO[1] + xH1[1]*fH[1] + xH2[1]*fH[1];
+                v[2] += x[j][2]*fO[2] + xH1[2]*fH[2] + xH2[2]*fH[2];
+                v[3] += x[j][0]*fO[1] + xH1[0]*fH[1] + xH2[0]*fH[1];
+                v[4] += x[j][0]*fO[2] + xH1[0]*fH[2] + xH2[0]*fH[2];
+                v[5] += x[j][1]*fO[2] + xH1[1]*fH[2] + xH2[1]*fH[2];
+              }
+              vlist[n++] = j;
+              vlist[n++] = jH1;
+              vlist[n++] = jH2;
             }
-            vlist[n++] = j;
-            vlist[n++] = jH1;
-            vlist[n++] = jH2;
           }
 
           if (eflag) {
@@ -425,6 +453,31 @@ void PairLJCutTIP4PLong::compute(int eflag, int vflag)
       }
     }
   }
+
+  // partition accumulated M-site forces to O,H atoms in one pass
+  // hneigh[i][2] is set only for atoms whose M site was used this step
+  // ghost contributions are summed back by the reverse communication
+
+  if (!evflag) {
+    double fx,fy,fz;
+    for (i = 0; i < nall; i++) {
+      if (hneigh[i][2] == 0) continue;
+      iH1 = hneigh[i][0];
+      iH2 = hneigh[i][1];
+      fx = fmsite[i][0];
+      fy = fmsite[i][1];
+      fz = fmsite[i][2];
+      f[i][0] += fx*(1 - alpha);
+      f[i][1] += fy*(1 - alpha);
+      f[i][2] += fz*(1 - alpha);
+      f[iH1][0] += 0.5 * alpha * fx;
+      f[iH1][1] += 0.5 * alpha * fy;
+      f[iH1][2] += 0.5 * alpha * fz;
+      f[iH2][0] += 0.5 * alpha * fx;
+      f[iH2][1] += 0.5 * alpha * fy;
+      f[iH2][2] += 0.5 * alpha * fz;
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -611,5 +664,6 @@ double PairLJCutTIP4PLong::memory_usage()
   double bytes = maxeatom * sizeof(double);
   bytes += maxvatom*6 * sizeof(double);
   bytes += 2 * nmax * sizeof(double);
+  bytes += 3 * nmax * sizeof(double);
   return bytes;
 }
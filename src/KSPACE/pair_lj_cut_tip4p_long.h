@@ -46,6 +46,8 @@ class PairLJCutTIP4PLong : public PairLJCutCoulLong {
   int **hneigh;                // 0,1 = indices of 2 H associated with O
                                // 2 = 0 if site loc not yet computed, 1 if yes
   double **newsite;            // locations of charge sites
+  double **fmsite;             // M-site forces accumulated on non-tally
+                               //   steps, partitioned in one post-pass
 
   void compute_newsite(double *, double *, double *, double *);
 };
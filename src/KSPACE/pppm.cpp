@@ -77,11 +77,15 @@ PPPM::PPPM(LAMMPS *lmp, int narg, char **arg) : KSpace(lmp, narg, arg),
 {
   peratom_allocate_flag = 0;
   group_allocate_flag = 0;
+  grid_allocate_flag = 0;
 
   if (narg < 1) error->all(FLERR,"Illegal kspace_style pppm command");
 
   pppmflag = 1;
   group_group_enable = 1;
+  pipeline_capable = 1;
+  fpipeline = NULL;
+  maxfpipeline = 0;
   triclinic = domain->triclinic;
 
   accuracy_relative = fabs(force->numeric(FLERR,arg[0]));
@@ -175,6 +179,49 @@ PPPM::~PPPM()
   if (group_allocate_flag) deallocate_groups();
   memory->destroy(part2grid);
   memory->destroy(acons);
+  memory->destroy(fpipeline);
+}
+
+/* ----------------------------------------------------------------------
+   setup force output buffer for a pipelined compute()
+   called by the integrator before running compute() concurrently with
+   the pair computation; fieldforce et al. then accumulate into
+   fpipeline instead of atom->f, so the pair thread owns atom->f alone
+------------------------------------------------------------------------- */
+
+void PPPM::pipeline_prepare()
+{
+  if (atom->nmax > maxfpipeline) {
+    memory->destroy(fpipeline);
+    maxfpipeline = atom->nmax;
+    memory->create(fpipeline,maxfpipeline,3,"pppm:fpipeline");
+  }
+
+  int nall = atom->nlocal + atom->nghost;
+  for (int i = 0; i < nall; i++)
+    fpipeline[i][0] = fpipeline[i][1] = fpipeline[i][2] = 0.0;
+
+  pipeline_active = 1;
+}
+
+/* ----------------------------------------------------------------------
+   fold the buffered kspace forces into atom->f
+   called by the integrator after the concurrent section has joined,
+   before any reverse communication of forces
+------------------------------------------------------------------------- */
+
+void PPPM::pipeline_merge()
+{
+  double **f = atom->f;
+  int nall = atom->nlocal + atom->nghost;
+
+  for (int i = 0; i < nall; i++) {
+    f[i][0] += fpipeline[i][0];
+    f[i][1] += fpipeline[i][1];
+    f[i][2] += fpipeline[i][2];
+  }
+
+  pipeline_active = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -284,11 +331,14 @@ void PPPM::init()
   if (accuracy_absolute >= 0.0) accuracy = accuracy_absolute;
   else accuracy = accuracy_relative * two_charge_force;
 
-  // free all arrays previously allocated
+  // snapshot the grid decision of the previous init()
+  // if the decision below comes out identical, the K-space arrays, grid
+  //   communicator, and FFT plans are re-used instead of being torn down
+  //   and rebuilt, since plan creation is the expensive part of init()
+  //   for scripts that invoke run many times
 
-  deallocate();
-  if (peratom_allocate_flag) deallocate_peratom();
-  if (group_allocate_flag) deallocate_groups();
+  int gridold[23],gridnew[23];
+  grid_signature(gridold);
 
   // setup FFT grid resolution and g_ewald
   // normally one iteration thru while loop is all that is required
@@ -378,12 +428,35 @@ void PPPM::init()
     }
   }
 
-  // allocate K-space dependent memory
+  // allocate K-space dependent memory, unless the grid decision is
+  //   unchanged from the previous init(), then everything sized by it
+  //   (bricks, FFT plans, grid communicator) is still valid
   // don't invoke allocate peratom() or group(), will be allocated when needed
 
-  allocate();
-  cg->ghost_notify();
-  cg->setup();
+  grid_signature(gridnew);
+  int reuse = grid_allocate_flag;
+  if (reuse)
+    for (int i = 0; i < 23; i++)
+      if (gridnew[i] != gridold[i]) reuse = 0;
+
+  // signature includes per-proc brick/FFT bounds which can change on
+  //   a subset of procs, e.g. after a balance command moved the
+  //   sub-domain boundaries, and the rebuild is collective,
+  //   so all procs must agree on the reuse decision
+
+  int reuse_all;
+  MPI_Allreduce(&reuse,&reuse_all,1,MPI_INT,MPI_MIN,world);
+
+  if (!reuse_all) {
+    deallocate();
+    if (peratom_allocate_flag) deallocate_peratom();
+    if (group_allocate_flag) deallocate_groups();
+
+    allocate();
+    grid_allocate_flag = 1;
+    cg->ghost_notify();
+    cg->setup();
+  }
 
   // pre-compute Green's function denomiator expansion
   // pre-compute 1d charge distribution coefficients
@@ -977,6 +1050,29 @@ void PPPM::deallocate_peratom()
   delete cg_peratom;
 }
 
+/* ----------------------------------------------------------------------
+   store in sig everything the allocations of allocate() depend on:
+   global grid size, order, differentiation mode, local grid bounds
+   init() compares signatures before/after the grid decision to decide
+   whether existing arrays and FFT plans can be re-used
+------------------------------------------------------------------------- */
+
+void PPPM::grid_signature(int *sig)
+{
+  sig[0] = nx_pppm; sig[1] = ny_pppm; sig[2] = nz_pppm;
+  sig[3] = order;
+  sig[4] = differentiation_flag;
+  sig[5] = nxlo_in; sig[6] = nxhi_in;
+  sig[7] = nylo_in; sig[8] = nyhi_in;
+  sig[9] = nzlo_in; sig[10] = nzhi_in;
+  sig[11] = nxlo_out; sig[12] = nxhi_out;
+  sig[13] = nylo_out; sig[14] = nyhi_out;
+  sig[15] = nzlo_out; sig[16] = nzhi_out;
+  sig[17] = nxlo_fft; sig[18] = nxhi_fft;
+  sig[19] = nylo_fft; sig[20] = nyhi_fft;
+  sig[21] = nzlo_fft; sig[22] = nzhi_fft;
+}
+
 /* ----------------------------------------------------------------------
    set global size of PPPM grid = nx,ny,nz_pppm
    used for charge accumulation, FFTs, and electric field interpolation
@@ -1950,7 +2046,7 @@ void PPPM::particle_map()
 
 void PPPM::make_rho()
 {
-  int l,m,n,nx,ny,nz,mx,my,mz;
+  int l,m,n,nx,ny,nz,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
 
   // clear 3d density array
@@ -1985,10 +2081,12 @@ void PPPM::make_rho()
       for (m = nlower; m <= nupper; m++) {
         my = m+ny;
         x0 = y0*rho1d[1][m];
-        for (l = nlower; l <= nupper; l++) {
-          mx = l+nx;
-          density_brick[mz][my][mx] += x0*rho1d[0][l];
-        }
+
+        // stencil writes for fixed (mz,my) hit one contiguous brick row
+
+        FFT_SCALAR * const row = &density_brick[mz][my][nx];
+        for (l = nlower; l <= nupper; l++)
+          row[l] += x0*rho1d[0][l];
       }
     }
   }
@@ -2452,7 +2550,7 @@ void PPPM::fieldforce()
 
 void PPPM::fieldforce_ik()
 {
-  int i,l,m,n,nx,ny,nz,mx,my,mz;
+  int i,l,m,n,nx,ny,nz,my,mz;
   FFT_SCALAR dx,dy,dz,x0,y0,z0;
   FFT_SCALAR ekx,eky,ekz;
 
@@ -2464,7 +2562,7 @@ void PPPM::fieldforce_ik()
 
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   int nlocal = atom->nlocal;
 
@@ -2485,12 +2583,17 @@ void PPPM::fieldforce_ik()
       for (m = nlower; m <= nupper; m++) {
         my = m+ny;
         y0 = z0*rho1d[1][m];
+
+        // stencil reads for fixed (mz,my) hit contiguous brick rows
+
+        const FFT_SCALAR * const vdx_row = &vdx_brick[mz][my][nx];
+        const FFT_SCALAR * const vdy_row = &vdy_brick[mz][my][nx];
+        const FFT_SCALAR * const vdz_row = &vdz_brick[mz][my][nx];
         for (l = nlower; l <= nupper; l++) {
-          mx = l+nx;
           x0 = y0*rho1d[0][l];
-          ekx -= x0*vdx_brick[mz][my][mx];
-          eky -= x0*vdy_brick[mz][my][mx];
-          ekz -= x0*vdz_brick[mz][my][mx];
+          ekx -= x0*vdx_row[l];
+          eky -= x0*vdy_row[l];
+          ekz -= x0*vdz_row[l];
         }
       }
     }
@@ -2510,7 +2613,7 @@ void PPPM::fieldforce_ik()
 
 void PPPM::fieldforce_ad()
 {
-  int i,l,m,n,nx,ny,nz,mx,my,mz;
+  int i,l,m,n,nx,ny,nz,my,mz;
   FFT_SCALAR dx,dy,dz;
   FFT_SCALAR ekx,eky,ekz;
   double s1,s2,s3;
@@ -2534,7 +2637,7 @@ void PPPM::fieldforce_ad()
 
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   int nlocal = atom->nlocal;
 
@@ -2554,11 +2657,14 @@ void PPPM::fieldforce_ad()
       mz = n+nz;
       for (m = nlower; m <= nupper; m++) {
         my = m+ny;
+
+        // stencil reads for fixed (mz,my) hit one contiguous brick row
+
+        const FFT_SCALAR * const u_row = &u_brick[mz][my][nx];
         for (l = nlower; l <= nupper; l++) {
-          mx = l+nx;
-          ekx += drho1d[0][l]*rho1d[1][m]*rho1d[2][n]*u_brick[mz][my][mx];
-          eky += rho1d[0][l]*drho1d[1][m]*rho1d[2][n]*u_brick[mz][my][mx];
-          ekz += rho1d[0][l]*rho1d[1][m]*drho1d[2][n]*u_brick[mz][my][mx];
+          ekx += drho1d[0][l]*rho1d[1][m]*rho1d[2][n]*u_row[l];
+          eky += rho1d[0][l]*drho1d[1][m]*rho1d[2][n]*u_row[l];
+          ekz += rho1d[0][l]*rho1d[1][m]*drho1d[2][n]*u_row[l];
         }
       }
     }
@@ -3007,7 +3113,7 @@ void PPPM::slabcorr()
   // add on force corrections
 
   double ffact = qscale * (-4.0*MY_PI/volume);
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   for (int i = 0; i < nlocal; i++) f[i][2] += ffact * q[i]*(dipole_all - qsum*x[i][2]);
 }
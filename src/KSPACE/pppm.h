@@ -39,6 +39,8 @@ class PPPM : public KSpace {
  public:
   PPPM(class LAMMPS *, int, char **);
   virtual ~PPPM();
+  virtual void pipeline_prepare();
+  virtual void pipeline_merge();
   virtual void init();
   virtual void setup();
   void setup_grid();
@@ -59,6 +61,7 @@ class PPPM : public KSpace {
   double h_x,h_y,h_z;
   double shift,shiftone;
   int peratom_allocate_flag;
+  int grid_allocate_flag;      // 1 if allocate() arrays/plans currently exist
 
   int nxlo_in,nylo_in,nzlo_in,nxhi_in,nyhi_in,nzhi_in;
   int nxlo_out,nylo_out,nzlo_out,nxhi_out,nyhi_out,nzhi_out;
@@ -85,6 +88,9 @@ class PPPM : public KSpace {
   double sf_coeff[6];          // coefficients for calculating ad self-forces
   double **acons;
 
+  double **fpipeline;          // force output buffer for pipelined compute
+  int maxfpipeline;            // allocated atoms in fpipeline
+
   // group-group interactions
 
   int group_allocate_flag;
@@ -106,6 +112,7 @@ class PPPM : public KSpace {
   double alpha;                // geometric factor
 
   void set_grid_global();
+  void grid_signature(int *);
   void set_grid_local();
   void adjust_gewald();
   double newton_raphson_f();
@@ -384,7 +384,7 @@ void PPPMCG::fieldforce_ik()
 
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   for (int j = 0; j < num_charged; j++) {
     i = is_charged[j];
@@ -456,7 +456,7 @@ void PPPMCG::fieldforce_ad()
 
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   for (int j = 0; j < num_charged; j++) {
     i = is_charged[j];
@@ -151,6 +151,18 @@ void PPPMStagger::compute(int eflag, int vflag)
     memory->create(part2grid,nmax,3,"pppm:part2grid");
   }
 
+  // one full assignment/solve/interpolation pass per stagger offset
+  // the passes cannot share an FFT: each offset grid holds its own
+  //   density distribution, so only the workspace arrays are shared,
+  //   which already happens since each pass overwrites them
+  // scattering both offsets in one make_rho() sweep would need a
+  //   second density brick and save no flops, so the per-pass cost is
+  //   inherent to interlacing; the method's payoff is that the 2-pass
+  //   solve on a coarser grid beats a 1-pass solve on a finer one
+  // offsets beyond 2 are not supported: the optimal Green's function
+  //   coefficients in gf_b2 are derived for the 2-grid interlacing of
+  //   (Cerutti), and more offsets sharpen the tradeoff above
+
   nstagger = 2;
 
   stagger = 0.0;
@@ -780,7 +792,7 @@ void PPPMStagger::fieldforce_ik()
 
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   int nlocal = atom->nlocal;
 
@@ -850,7 +862,7 @@ void PPPMStagger::fieldforce_ad()
 
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   int nlocal = atom->nlocal;
 
@@ -187,7 +187,7 @@ void PPPMTIP4P::fieldforce_ik()
   // ek = 3 components of E-field on particle
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   int *type = atom->type;
   int nlocal = atom->nlocal;
@@ -289,7 +289,7 @@ void PPPMTIP4P::fieldforce_ad()
 
   double *q = atom->q;
   double **x = atom->x;
-  double **f = atom->f;
+  double **f = pipeline_active ? fpipeline : atom->f;
 
   int *type = atom->type;
   int nlocal = atom->nlocal;
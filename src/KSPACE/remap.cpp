@@ -115,90 +115,32 @@ void remap_3d(FFT_SCALAR *in, FFT_SCALAR *out, FFT_SCALAR *buf,
     if (plan->commringlen > 0) {
       int isend,irecv;
 
-      // create send and recv buffers for alltoallv collective
+      // counts, displacements, ring->message maps, and packed buffers
+      // were all precomputed when the plan was created
 
-      int sendBufferSize = 0;
-      int recvBufferSize = 0;
-      for (int i=0;i<plan->nsend;i++)
-        sendBufferSize += plan->send_size[i];
-      for (int i=0;i<plan->nrecv;i++)
-        recvBufferSize += plan->recv_size[i];
+      // pack send data in ring order
 
-      FFT_SCALAR *packedSendBuffer
-        = (FFT_SCALAR *) malloc(sizeof(FFT_SCALAR) * sendBufferSize);
-      FFT_SCALAR *packedRecvBuffer
-        = (FFT_SCALAR *) malloc(sizeof(FFT_SCALAR) * recvBufferSize);
-
-      int *sendcnts = (int *) malloc(sizeof(int) * plan->commringlen);
-      int *rcvcnts = (int *) malloc(sizeof(int) * plan->commringlen);
-      int *sdispls = (int *) malloc(sizeof(int) * plan->commringlen);
-      int *rdispls = (int *) malloc(sizeof(int) * plan->commringlen);
-      int *nrecvmap = (int *) malloc(sizeof(int) * plan->commringlen);
-
-      // create and populate send data, count and displacement buffers
-
-      int currentSendBufferOffset = 0;
       for (isend = 0; isend < plan->commringlen; isend++) {
-        sendcnts[isend] = 0;
-        sdispls[isend] = 0;
-        int foundentry = 0;
-        for (int i=0;(i<plan->nsend && !foundentry); i++) {
-          if (plan->send_proc[i] == plan->commringlist[isend]) {
-            foundentry = 1;
-            sendcnts[isend] = plan->send_size[i];
-            sdispls[isend] = currentSendBufferOffset;
-            plan->pack(&in[plan->send_offset[i]],
-                       &packedSendBuffer[currentSendBufferOffset],
-                       &plan->packplan[i]);
-            currentSendBufferOffset += plan->send_size[i];
-          }
-        }
-      }
-
-      // create and populate recv count and displacement buffers
-
-      int currentRecvBufferOffset = 0;
-      for (irecv = 0; irecv < plan->commringlen; irecv++) {
-        rcvcnts[irecv] = 0;
-        rdispls[irecv] = 0;
-        nrecvmap[irecv] = -1;
-        int foundentry = 0;
-        for (int i=0;(i<plan->nrecv && !foundentry); i++) {
-          if (plan->recv_proc[i] == plan->commringlist[irecv]) {
-            foundentry = 1;
-            rcvcnts[irecv] = plan->recv_size[i];
-            rdispls[irecv] = currentRecvBufferOffset;
-            currentRecvBufferOffset += plan->recv_size[i];
-            nrecvmap[irecv] = i;
-          }
-        }
+        int i = plan->coll_sendmap[isend];
+        if (i > -1)
+          plan->pack(&in[plan->send_offset[i]],
+                     &plan->coll_sendbuf[plan->coll_sdispls[isend]],
+                     &plan->packplan[i]);
       }
 
-      MPI_Alltoallv(packedSendBuffer, sendcnts, sdispls,
-                    MPI_FFT_SCALAR, packedRecvBuffer, rcvcnts,
-                    rdispls, MPI_FFT_SCALAR, plan->comm);
+      MPI_Alltoallv(plan->coll_sendbuf, plan->coll_sendcnts,
+                    plan->coll_sdispls, MPI_FFT_SCALAR,
+                    plan->coll_recvbuf, plan->coll_rcvcnts,
+                    plan->coll_rdispls, MPI_FFT_SCALAR, plan->comm);
 
       // unpack the data from the recv buffer into out
 
-      currentRecvBufferOffset = 0;
       for (irecv = 0; irecv < plan->commringlen; irecv++) {
-        if (nrecvmap[irecv] > -1) {
-          plan->unpack(&packedRecvBuffer[currentRecvBufferOffset],
-                       &out[plan->recv_offset[nrecvmap[irecv]]],
-                       &plan->unpackplan[nrecvmap[irecv]]);
-          currentRecvBufferOffset += plan->recv_size[nrecvmap[irecv]];
-        }
+        int i = plan->coll_recvmap[irecv];
+        if (i > -1)
+          plan->unpack(&plan->coll_recvbuf[plan->coll_rdispls[irecv]],
+                       &out[plan->recv_offset[i]],&plan->unpackplan[i]);
       }
-
-      // free temporary data structures
-
-      free(sendcnts);
-      free(rcvcnts);
-      free(sdispls);
-      free(rdispls);
-      free(nrecvmap);
-      free(packedSendBuffer);
-      free(packedRecvBuffer);
     }
   }
 }
@@ -253,6 +195,10 @@ struct remap_plan_3d *remap_3d_create_plan(
   plan = (struct remap_plan_3d *) malloc(sizeof(struct remap_plan_3d));
   if (plan == NULL) return NULL;
   plan->usecollective = usecollective;
+  plan->coll_sendcnts = plan->coll_rcvcnts = NULL;
+  plan->coll_sdispls = plan->coll_rdispls = NULL;
+  plan->coll_sendmap = plan->coll_recvmap = NULL;
+  plan->coll_sendbuf = plan->coll_recvbuf = NULL;
 
   // store parameters in local data structs
 
@@ -612,6 +558,50 @@ struct remap_plan_3d *remap_3d_create_plan(
     MPI_Group_incl(orig_group, plan->commringlen,
                    plan->commringlist, &new_group);
     MPI_Comm_create(comm, new_group, &plan->comm);
+
+    // precompute alltoallv counts, displacements, ring->message maps,
+    // and persistent packed buffers, so remap_3d() does no setup work
+
+    int n = plan->commringlen;
+    plan->coll_sendcnts = (int *) malloc(n*sizeof(int));
+    plan->coll_rcvcnts = (int *) malloc(n*sizeof(int));
+    plan->coll_sdispls = (int *) malloc(n*sizeof(int));
+    plan->coll_rdispls = (int *) malloc(n*sizeof(int));
+    plan->coll_sendmap = (int *) malloc(n*sizeof(int));
+    plan->coll_recvmap = (int *) malloc(n*sizeof(int));
+
+    int sendsize = 0;
+    for (i = 0; i < n; i++) {
+      plan->coll_sendcnts[i] = 0;
+      plan->coll_sdispls[i] = sendsize;
+      plan->coll_sendmap[i] = -1;
+      for (int j = 0; j < plan->nsend; j++)
+        if (plan->send_proc[j] == plan->commringlist[i]) {
+          plan->coll_sendcnts[i] = plan->send_size[j];
+          plan->coll_sendmap[i] = j;
+          sendsize += plan->send_size[j];
+          break;
+        }
+    }
+
+    int recvsize = 0;
+    for (i = 0; i < n; i++) {
+      plan->coll_rcvcnts[i] = 0;
+      plan->coll_rdispls[i] = recvsize;
+      plan->coll_recvmap[i] = -1;
+      for (int j = 0; j < plan->nrecv; j++)
+        if (plan->recv_proc[j] == plan->commringlist[i]) {
+          plan->coll_rcvcnts[i] = plan->recv_size[j];
+          plan->coll_recvmap[i] = j;
+          recvsize += plan->recv_size[j];
+          break;
+        }
+    }
+
+    if (sendsize) plan->coll_sendbuf =
+      (FFT_SCALAR *) malloc(sendsize*sizeof(FFT_SCALAR));
+    if (recvsize) plan->coll_recvbuf =
+      (FFT_SCALAR *) malloc(recvsize*sizeof(FFT_SCALAR));
   }
 
   // if using collective and the comm ring list is empty create
@@ -644,6 +634,16 @@ void remap_3d_destroy_plan(struct remap_plan_3d *plan)
   if (plan->usecollective) {
     if (plan->commringlist != NULL)
       free(plan->commringlist);
+    if (plan->coll_sendcnts != NULL) {
+      free(plan->coll_sendcnts);
+      free(plan->coll_rcvcnts);
+      free(plan->coll_sdispls);
+      free(plan->coll_rdispls);
+      free(plan->coll_sendmap);
+      free(plan->coll_recvmap);
+    }
+    if (plan->coll_sendbuf != NULL) free(plan->coll_sendbuf);
+    if (plan->coll_recvbuf != NULL) free(plan->coll_recvbuf);
   }
 
   // free internal arrays
@@ -48,6 +48,14 @@ struct remap_plan_3d {
   int usecollective;                // use collective or point-to-point MPI
   int commringlen;                  // length of commringlist
   int *commringlist;                // ranks on communication ring of this plan
+  int *coll_sendcnts;               // precomputed alltoallv send counts
+  int *coll_rcvcnts;                // precomputed alltoallv recv counts
+  int *coll_sdispls;                // precomputed alltoallv send displs
+  int *coll_rdispls;                // precomputed alltoallv recv displs
+  int *coll_sendmap;                // ring index -> send index, -1 if none
+  int *coll_recvmap;                // ring index -> recv index, -1 if none
+  FFT_SCALAR *coll_sendbuf;         // persistent packed collective send buf
+  FFT_SCALAR *coll_recvbuf;         // persistent packed collective recv buf
 };
 
 // collision between 2 regions
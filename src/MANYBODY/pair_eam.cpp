@@ -446,6 +446,16 @@ double PairEAM::init_one(int i, int j)
 
 /* ----------------------------------------------------------------------
    read potential values from a DYNAMO single element funcfl file
+   only proc 0 of each world opens the file, then bcasts to its world,
+     so at most one rank per partition touches the filesystem
+   placing the tables in node-shared read-only memory mapped by all
+     partitions of a multi-partition run was evaluated and rejected:
+     the raw file data is reprocessed per pair instance (grid
+     unification in file2array, spline fits in array2spline) with
+     settings that may differ across partitions, partitions execute
+     their scripts asynchronously so any universe-spanning collective
+     inside pair_coeff can deadlock, and the tree has no MPI-3
+     shared-window usage and must keep building against the MPI stubs
 ------------------------------------------------------------------------- */
 
 void PairEAM::read_file(char *filename)
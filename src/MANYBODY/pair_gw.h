@@ -57,6 +57,8 @@ class PairGW : public Pair {
   int nelements;                // # of unique elements
   int nparams;                  // # of stored parameter sets
   int maxparam;                 // max # of parameter sets
+  int maxshort;                 // size of short neighbor list array
+  int *neighshort;              // short neighbor list array
 
   int **pages;                     // neighbor list pages
   int maxlocal;                    // size of numneigh, firstneigh arrays
@@ -54,6 +54,9 @@ PairNb3bHarmonic::PairNb3bHarmonic(LAMMPS *lmp) : Pair(lmp)
   params = NULL;
   elem2param = NULL;
   map = NULL;
+
+  maxshort = 10;
+  neighshort = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -71,6 +74,7 @@ PairNb3bHarmonic::~PairNb3bHarmonic()
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
+    memory->destroy(neighshort);
     delete [] map;
   }
 }
@@ -108,11 +112,14 @@ void PairNb3bHarmonic::compute(int eflag, int vflag)
     ytmp = x[i][1];
     ztmp = x[i][2];
 
+    // build short neighbor list of atoms within cutoff of atom i
+    // three-body loops then scale with its length, not the full list
+
     jlist = firstneigh[i];
     jnum = numneigh[i];
-    jnumm1 = jnum - 1;
+    int numshort = 0;
 
-    for (jj = 0; jj < jnumm1; jj++) {
+    for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       j &= NEIGHMASK;
       jtype = map[type[j]];
@@ -122,10 +129,26 @@ void PairNb3bHarmonic::compute(int eflag, int vflag)
       delr1[2] = x[j][2] - ztmp;
       rsq1 = delr1[0]*delr1[0] + delr1[1]*delr1[1] + delr1[2]*delr1[2];
       if (rsq1 > params[ijparam].cutsq) continue;
+      neighshort[numshort++] = j;
+      if (numshort >= maxshort) {
+        maxshort += maxshort/2;
+        memory->grow(neighshort,maxshort,"pair:neighshort");
+      }
+    }
+
+    jnumm1 = numshort - 1;
 
-      for (kk = jj+1; kk < jnum; kk++) {
-        k = jlist[kk];
-        k &= NEIGHMASK;
+    for (jj = 0; jj < jnumm1; jj++) {
+      j = neighshort[jj];
+      jtype = map[type[j]];
+      ijparam = elem2param[itype][jtype][jtype];
+      delr1[0] = x[j][0] - xtmp;
+      delr1[1] = x[j][1] - ytmp;
+      delr1[2] = x[j][2] - ztmp;
+      rsq1 = delr1[0]*delr1[0] + delr1[1]*delr1[1] + delr1[2]*delr1[2];
+
+      for (kk = jj+1; kk < numshort; kk++) {
+        k = neighshort[kk];
         ktype = map[type[k]];
         ikparam = elem2param[itype][ktype][ktype];
         ijkparam = elem2param[itype][jtype][ktype];
@@ -134,7 +157,6 @@ void PairNb3bHarmonic::compute(int eflag, int vflag)
         delr2[1] = x[k][1] - ytmp;
         delr2[2] = x[k][2] - ztmp;
         rsq2 = delr2[0]*delr2[0] + delr2[1]*delr2[1] + delr2[2]*delr2[2];
-        if (rsq2 > params[ikparam].cutsq) continue;
 
         threebody(&params[ijparam],&params[ikparam],&params[ijkparam],
                   rsq1,rsq2,delr1,delr2,fj,fk,eflag,evdwl);
@@ -166,7 +188,7 @@ void PairNb3bHarmonic::allocate()
 
   memory->create(setflag,n+1,n+1,"pair:setflag");
   memory->create(cutsq,n+1,n+1,"pair:cutsq");
-
+  memory->create(neighshort,maxshort,"pair:neighshort");
   map = new int[n+1];
 }
 
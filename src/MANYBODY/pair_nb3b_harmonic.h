@@ -48,6 +48,8 @@ class PairNb3bHarmonic : public Pair {
   int *map;                     // mapping from atom types to elements
   int nparams;                  // # of stored parameter sets
   int maxparam;                 // max # of parameter sets
+  int maxshort;                 // size of short neighbor list array
+  int *neighshort;              // short neighbor list array
   Param *params;                // parameter set for an I-J-K interaction
 
   void allocate();
@@ -281,6 +281,16 @@ void FixAtomSwap::init()
         if (cutsq[type_list[iswaptype]][ktype] != cutsq[type_list[jswaptype]][ktype])
           unequal_cutoffs = true;
 
+  // semi-grand trial moves change only one atom's pair interactions
+  //   when the energy is strictly pairwise additive,
+  //   so the energy change can be evaluated from that atom alone
+
+  delta_flag = 0;
+  if (semi_grand_flag && !unequal_cutoffs &&
+      force->pair->single_enable && !force->pair->manybody_flag &&
+      !force->pair->tail_flag && !force->kspace && !atom->molecular)
+    delta_flag = 1;
+
   // check that no swappable atoms are in atom->firstgroup
   // swapping such an atom might not leave firstgroup atoms first
 
@@ -347,6 +357,7 @@ int FixAtomSwap::attempt_semi_grand()
   double energy_before = energy_stored;
 
   int itype,jtype,jswaptype;
+  itype = jtype = 0;
   int i = pick_semi_grand_atom();
   if (i >= 0) {
     jswaptype = static_cast<int> (nswaptypes*random_unequal->uniform());
@@ -356,9 +367,45 @@ int FixAtomSwap::attempt_semi_grand()
       jswaptype = static_cast<int> (nswaptypes*random_unequal->uniform());
       jtype = type_list[jswaptype];
     }
-    atom->type[i] = jtype;
   }
 
+  // evaluate the energy change from the picked atom's interactions
+  //   alone when the move cannot affect any other energy term
+  // nothing changes and no communication is needed on rejection
+
+  if (delta_flag) {
+    double de = 0.0;
+    int success = 0;
+    if (i >= 0) {
+      de = energy_local(i,jtype) - energy_local(i,itype);
+      if (random_unequal->uniform() <
+          exp(-beta*(de + mu[jtype] - mu[itype]))) success = 1;
+    }
+
+    int success_all = 0;
+    MPI_Allreduce(&success,&success_all,1,MPI_INT,MPI_MAX,world);
+
+    if (success_all) {
+      double de_all = 0.0;
+      MPI_Allreduce(&de,&de_all,1,MPI_DOUBLE,MPI_SUM,world);
+      if (i >= 0) {
+        atom->type[i] = jtype;
+        if (conserve_ke_flag) {
+          atom->v[i][0] *= sqrt_mass_ratio[itype][jtype];
+          atom->v[i][1] *= sqrt_mass_ratio[itype][jtype];
+          atom->v[i][2] *= sqrt_mass_ratio[itype][jtype];
+        }
+      }
+      comm->forward_comm_fix(this);
+      update_semi_grand_atoms_list();
+      energy_stored += de_all;
+      return 1;
+    }
+    return 0;
+  }
+
+  if (i >= 0) atom->type[i] = jtype;
+
   if (unequal_cutoffs) {
     if (domain->triclinic) domain->x2lamda(atom->nlocal);
     domain->pbc();
@@ -529,6 +576,55 @@ double FixAtomSwap::energy_full()
   return total_energy;
 }
 
+/* ----------------------------------------------------------------------
+   pair interaction energy of atom I with all owned+ghost atoms,
+     evaluated as if atom I had the given type
+   used to form the energy change of a trial type swap without a full
+     energy evaluation, valid only for pairwise additive energies
+   pairs with atom I are summed only by the proc that owns atom I,
+     so no reduction over procs is needed for one atom's energy
+------------------------------------------------------------------------- */
+
+double FixAtomSwap::energy_local(int i, int itype)
+{
+  double delx,dely,delz,rsq;
+
+  double **x = atom->x;
+  int *type = atom->type;
+  tagint *tag = atom->tag;
+  int nall = atom->nlocal + atom->nghost;
+  Pair *pair = force->pair;
+  double **cutsq = force->pair->cutsq;
+
+  double fpair = 0.0;
+  double factor_coul = 1.0;
+  double factor_lj = 1.0;
+
+  double *cutsq_i = cutsq[itype];
+  double total_energy = 0.0;
+
+  for (int j = 0; j < nall; j++) {
+    if (i == j) continue;
+
+    delx = x[i][0] - x[j][0];
+    dely = x[i][1] - x[j][1];
+    delz = x[i][2] - x[j][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+
+    int jtype = type[j];
+
+    // ghost images of atom I itself also carry the trial type
+
+    if (tag[j] == tag[i]) jtype = itype;
+
+    if (rsq < cutsq_i[jtype])
+      total_energy +=
+        pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+  }
+
+  return total_energy;
+}
+
 /* ----------------------------------------------------------------------
 ------------------------------------------------------------------------- */
 
@@ -35,6 +35,7 @@ class FixAtomSwap : public Fix {
   int attempt_semi_grand();
   int attempt_swap();
   double energy_full();
+  double energy_local(int, int);
   int pick_semi_grand_atom();
   int pick_i_swap_atom();
   int pick_j_swap_atom();
@@ -70,6 +71,8 @@ class FixAtomSwap : public Fix {
   double nswap_successes;
 
   bool unequal_cutoffs;
+  int delta_flag;                         // 1 if trial energy change can be
+                                          //   evaluated from one atom alone
 
   int atom_swap_nmax;
   double beta;
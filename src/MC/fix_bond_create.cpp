@@ -386,6 +386,11 @@ void FixBondCreate::post_integrate()
     i = ilist[ii];
     if (!(mask[i] & groupbit)) continue;
     itype = type[i];
+
+    // skip atom I if it can never be either end of the new bond
+
+    if (itype != iatomtype && itype != jatomtype) continue;
+
     xtmp = x[i][0];
     ytmp = x[i][1];
     ztmp = x[i][2];
@@ -396,6 +401,17 @@ void FixBondCreate::post_integrate()
       j = jlist[jj];
       j &= NEIGHMASK;
       if (!(mask[j] & groupbit)) continue;
+
+      // distance test first, since the neighbor list cutoff typically
+      // exceeds the bonding cutoff by a lot and the eligibility tests
+      // below are more expensive than computing rsq
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq >= cutsq) continue;
+
       jtype = type[j];
 
       possible = 0;
@@ -417,12 +433,6 @@ void FixBondCreate::post_integrate()
         if (special[i][k] == tag[j]) possible = 0;
       if (!possible) continue;
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
-      if (rsq >= cutsq) continue;
-
       if (rsq < distsq[i]) {
         partner[i] = tag[j];
         distsq[i] = rsq;
@@ -2195,6 +2195,9 @@ void FixGCMC::attempt_molecule_insertion_full()
 
 /* ----------------------------------------------------------------------
    compute particle's interaction energy with the rest of the system
+   scans all owned+ghost atoms since the proposed coord is arbitrary:
+     an insertion is not in any neighbor list, and a translation or
+     rotation can move an atom further than the list skin covers
 ------------------------------------------------------------------------- */
 
 double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
@@ -2212,13 +2215,16 @@ double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
   double factor_coul = 1.0;
   double factor_lj = 1.0;
 
+  double *cutsq_i = cutsq[itype];
+  int molskip = 0;
+  if (exchmode == EXCHMOL || movemode == MOVEMOL) molskip = 1;
+
   double total_energy = 0.0;
 
   for (int j = 0; j < nall; j++) {
 
     if (i == j) continue;
-    if (exchmode == EXCHMOL || movemode == MOVEMOL)
-      if (imolecule == molecule[j]) continue;
+    if (molskip && imolecule == molecule[j]) continue;
 
     delx = coord[0] - x[j][0];
     dely = coord[1] - x[j][1];
@@ -2232,7 +2238,7 @@ double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
     if (overlap_flag && rsq < overlap_cutoffsq)
       return MAXENERGYSIGNAL;
 
-    if (rsq < cutsq[itype][jtype])
+    if (rsq < cutsq_i[jtype])
       total_energy +=
         pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
   }
@@ -625,8 +625,6 @@ void AngleTable::uf_lookup(int type, double x, double &u, double &f)
     u = tb->e[itable] + fraction*tb->de[itable];
     f = tb->f[itable] + fraction*tb->df[itable];
   } else if (tabstyle == SPLINE) {
-    fraction = (x - tb->ang[itable]) * tb->invdelta;
-
     b = (x - tb->ang[itable]) * tb->invdelta;
     a = 1.0 - b;
     u = a * tb->e[itable] + b * tb->e[itable+1] +
@@ -659,8 +657,6 @@ void AngleTable::u_lookup(int type, double x, double &u)
     fraction = (x - tb->ang[itable]) * tb->invdelta;
     u = tb->e[itable] + fraction*tb->de[itable];
   } else if (tabstyle == SPLINE) {
-    fraction = (x - tb->ang[itable]) * tb->invdelta;
-
     b = (x - tb->ang[itable]) * tb->invdelta;
     a = 1.0 - b;
     u = a * tb->e[itable] + b * tb->e[itable+1] +
@@ -586,6 +586,7 @@ double BondTable::splint(double *xa, double *ya, double *y2a, int n, double x)
 /* ----------------------------------------------------------------------
    calculate potential u and force f at distance x
    insure x is between bond min/max, exit with error if not
+   lookup is O(1) on the uniform table grid, no search is performed
 ------------------------------------------------------------------------- */
 
 void BondTable::uf_lookup(int type, double x, double &u, double &f)
@@ -613,8 +614,6 @@ void BondTable::uf_lookup(int type, double x, double &u, double &f)
     u = tb->e[itable] + fraction*tb->de[itable];
     f = tb->f[itable] + fraction*tb->df[itable];
   } else if (tabstyle == SPLINE) {
-    fraction = (x - tb->r[itable]) * tb->invdelta;
-
     b = (x - tb->r[itable]) * tb->invdelta;
     a = 1.0 - b;
     u = a * tb->e[itable] + b * tb->e[itable+1] +
@@ -655,8 +654,6 @@ void BondTable::u_lookup(int type, double x, double &u)
     fraction = (x - tb->r[itable]) * tb->invdelta;
     u = tb->e[itable] + fraction*tb->de[itable];
   } else if (tabstyle == SPLINE) {
-    fraction = (x - tb->r[itable]) * tb->invdelta;
-
     b = (x - tb->r[itable]) * tb->invdelta;
     a = 1.0 - b;
     u = a * tb->e[itable] + b * tb->e[itable+1] +
@@ -32,7 +32,31 @@ using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
 
-PairEAMOpt::PairEAMOpt(LAMMPS *lmp) : PairEAM(lmp) {}
+PairEAMOpt::PairEAMOpt(LAMMPS *lmp) : PairEAM(lmp)
+{
+  fast_alpha = NULL;
+  fast_gamma = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairEAMOpt::~PairEAMOpt()
+{
+  free(fast_alpha);
+  free(fast_gamma);
+}
+
+/* ----------------------------------------------------------------------
+   invalidate the repacked tables whenever the splines they were
+   derived from are regenerated
+------------------------------------------------------------------------- */
+
+void PairEAMOpt::array2spline()
+{
+  PairEAM::array2spline();
+  free(fast_alpha); fast_alpha = NULL;
+  free(fast_gamma); fast_gamma = NULL;
+}
 
 /* ---------------------------------------------------------------------- */
 
@@ -62,18 +86,6 @@ void PairEAMOpt::eval()
 {
   typedef struct { double x,y,z; } vec3_t;
 
-  typedef struct {
-    double rhor0i,rhor1i,rhor2i,rhor3i;
-    double rhor0j,rhor1j,rhor2j,rhor3j;
-  } fast_alpha_t;
-
-  typedef struct {
-    double rhor4i,rhor5i,rhor6i;
-    double rhor4j,rhor5j,rhor6j;
-    double z2r0,z2r1,z2r2,z2r3,z2r4,z2r5,z2r6;
-    double _pad[3];
-  } fast_gamma_t;
-
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double evdwl = 0.0;
   double* _noalias coeff;
@@ -109,60 +121,67 @@ void PairEAMOpt::eval()
   int ntypes = atom->ntypes;
   int ntypes2 = ntypes*ntypes;
 
-  fast_alpha_t* _noalias fast_alpha =
-    (fast_alpha_t*) malloc(ntypes2*(nr+1)*sizeof(fast_alpha_t));
-  for (i = 0; i < ntypes; i++) for (j = 0; j < ntypes; j++) {
-    fast_alpha_t* _noalias tab = &fast_alpha[i*ntypes*nr+j*nr];
-    if (type2rhor[i+1][j+1] >= 0) {
-      for(int m = 1; m <= nr; m++) {
-        tab[m].rhor0i =  rhor_spline[type2rhor[i+1][j+1]][m][6];
-        tab[m].rhor1i =  rhor_spline[type2rhor[i+1][j+1]][m][5];
-        tab[m].rhor2i =  rhor_spline[type2rhor[i+1][j+1]][m][4];
-        tab[m].rhor3i =  rhor_spline[type2rhor[i+1][j+1]][m][3];
+  // repack spline coefficients once into the interleaved layout
+  // tables persist across calls until array2spline() discards them
+
+  if (fast_alpha == NULL) {
+    fast_alpha = (fast_alpha_t*) malloc(ntypes2*(nr+1)*sizeof(fast_alpha_t));
+    for (i = 0; i < ntypes; i++) for (j = 0; j < ntypes; j++) {
+      fast_alpha_t* _noalias tab = &fast_alpha[i*ntypes*nr+j*nr];
+      if (type2rhor[i+1][j+1] >= 0) {
+        for(int m = 1; m <= nr; m++) {
+          tab[m].rhor0i =  rhor_spline[type2rhor[i+1][j+1]][m][6];
+          tab[m].rhor1i =  rhor_spline[type2rhor[i+1][j+1]][m][5];
+          tab[m].rhor2i =  rhor_spline[type2rhor[i+1][j+1]][m][4];
+          tab[m].rhor3i =  rhor_spline[type2rhor[i+1][j+1]][m][3];
+        }
       }
-    }
-    if (type2rhor[j+1][i+1] >= 0) {
-      for(int m = 1; m <= nr; m++) {
-        tab[m].rhor0j =  rhor_spline[type2rhor[j+1][i+1]][m][6];
-        tab[m].rhor1j =  rhor_spline[type2rhor[j+1][i+1]][m][5];
-        tab[m].rhor2j =  rhor_spline[type2rhor[j+1][i+1]][m][4];
-        tab[m].rhor3j =  rhor_spline[type2rhor[j+1][i+1]][m][3];
+      if (type2rhor[j+1][i+1] >= 0) {
+        for(int m = 1; m <= nr; m++) {
+          tab[m].rhor0j =  rhor_spline[type2rhor[j+1][i+1]][m][6];
+          tab[m].rhor1j =  rhor_spline[type2rhor[j+1][i+1]][m][5];
+          tab[m].rhor2j =  rhor_spline[type2rhor[j+1][i+1]][m][4];
+          tab[m].rhor3j =  rhor_spline[type2rhor[j+1][i+1]][m][3];
+        }
       }
     }
   }
+
   fast_alpha_t* _noalias tabeight = fast_alpha;
 
-  fast_gamma_t* _noalias fast_gamma =
-    (fast_gamma_t*) malloc(ntypes2*(nr+1)*sizeof(fast_gamma_t));
-  for (i = 0; i < ntypes; i++) for (j = 0; j < ntypes; j++) {
-    fast_gamma_t* _noalias tab = &fast_gamma[i*ntypes*nr+j*nr];
-    if (type2rhor[i+1][j+1] >= 0) {
-      for(int m = 1; m <= nr; m++) {
-        tab[m].rhor4i =  rhor_spline[type2rhor[i+1][j+1]][m][2];
-        tab[m].rhor5i =  rhor_spline[type2rhor[i+1][j+1]][m][1];
-        tab[m].rhor6i =  rhor_spline[type2rhor[i+1][j+1]][m][0];
+  if (fast_gamma == NULL) {
+    fast_gamma = (fast_gamma_t*) malloc(ntypes2*(nr+1)*sizeof(fast_gamma_t));
+    for (i = 0; i < ntypes; i++) for (j = 0; j < ntypes; j++) {
+      fast_gamma_t* _noalias tab = &fast_gamma[i*ntypes*nr+j*nr];
+      if (type2rhor[i+1][j+1] >= 0) {
+        for(int m = 1; m <= nr; m++) {
+          tab[m].rhor4i =  rhor_spline[type2rhor[i+1][j+1]][m][2];
+          tab[m].rhor5i =  rhor_spline[type2rhor[i+1][j+1]][m][1];
+          tab[m].rhor6i =  rhor_spline[type2rhor[i+1][j+1]][m][0];
+        }
       }
-    }
-    if (type2rhor[j+1][i+1] >= 0) {
-      for(int m = 1; m <= nr; m++) {
-        tab[m].rhor4j =  rhor_spline[type2rhor[j+1][i+1]][m][2];
-        tab[m].rhor5j =  rhor_spline[type2rhor[j+1][i+1]][m][1];
-        tab[m].rhor6j =  rhor_spline[type2rhor[j+1][i+1]][m][0];
-        tab[m].z2r6 =  z2r_spline[type2z2r[i+1][j+1]][m][0];
+      if (type2rhor[j+1][i+1] >= 0) {
+        for(int m = 1; m <= nr; m++) {
+          tab[m].rhor4j =  rhor_spline[type2rhor[j+1][i+1]][m][2];
+          tab[m].rhor5j =  rhor_spline[type2rhor[j+1][i+1]][m][1];
+          tab[m].rhor6j =  rhor_spline[type2rhor[j+1][i+1]][m][0];
+          tab[m].z2r6 =  z2r_spline[type2z2r[i+1][j+1]][m][0];
+        }
       }
-    }
-    if (type2z2r[i+1][j+1] >= 0) {
-      for(int m = 1; m <= nr; m++) {
-        tab[m].z2r0 =  z2r_spline[type2z2r[i+1][j+1]][m][6];
-        tab[m].z2r1 =  z2r_spline[type2z2r[i+1][j+1]][m][5];
-        tab[m].z2r2 =  z2r_spline[type2z2r[i+1][j+1]][m][4];
-        tab[m].z2r3 =  z2r_spline[type2z2r[i+1][j+1]][m][3];
-        tab[m].z2r4 =  z2r_spline[type2z2r[i+1][j+1]][m][2];
-        tab[m].z2r5 =  z2r_spline[type2z2r[i+1][j+1]][m][1];
-        tab[m].z2r6 =  z2r_spline[type2z2r[i+1][j+1]][m][0];
+      if (type2z2r[i+1][j+1] >= 0) {
+        for(int m = 1; m <= nr; m++) {
+          tab[m].z2r0 =  z2r_spline[type2z2r[i+1][j+1]][m][6];
+          tab[m].z2r1 =  z2r_spline[type2z2r[i+1][j+1]][m][5];
+          tab[m].z2r2 =  z2r_spline[type2z2r[i+1][j+1]][m][4];
+          tab[m].z2r3 =  z2r_spline[type2z2r[i+1][j+1]][m][3];
+          tab[m].z2r4 =  z2r_spline[type2z2r[i+1][j+1]][m][2];
+          tab[m].z2r5 =  z2r_spline[type2z2r[i+1][j+1]][m][1];
+          tab[m].z2r6 =  z2r_spline[type2z2r[i+1][j+1]][m][0];
+        }
       }
     }
   }
+
   fast_gamma_t* _noalias tabss = fast_gamma;
 
   // zero out density
@@ -342,8 +361,5 @@ void PairEAMOpt::eval()
     ff[i].z += tmpfz;
   }
 
-  free(fast_alpha); fast_alpha = 0;
-  free(fast_gamma); fast_gamma = 0;
-
   if (vflag_fdotr) virial_fdotr_compute();
 }
@@ -29,9 +29,30 @@ namespace LAMMPS_NS {
 class PairEAMOpt : virtual public PairEAM {
  public:
   PairEAMOpt(class LAMMPS *);
-  virtual ~PairEAMOpt() {}
+  virtual ~PairEAMOpt();
   void compute(int, int);
 
+ protected:
+  // spline coefficients repacked into interleaved per type-pair tables
+  // built lazily by eval(), discarded whenever the splines are regenerated
+
+  typedef struct {
+    double rhor0i,rhor1i,rhor2i,rhor3i;
+    double rhor0j,rhor1j,rhor2j,rhor3j;
+  } fast_alpha_t;
+
+  typedef struct {
+    double rhor4i,rhor5i,rhor6i;
+    double rhor4j,rhor5j,rhor6j;
+    double z2r0,z2r1,z2r2,z2r3,z2r4,z2r5,z2r6;
+    double _pad[3];
+  } fast_gamma_t;
+
+  fast_alpha_t *fast_alpha;
+  fast_gamma_t *fast_gamma;
+
+  void array2spline();
+
  private:
   template < int EVFLAG, int EFLAG, int NEWTON_PAIR > void eval();
 };
@@ -107,6 +107,15 @@ void PairLJCharmmCoulLongOpt::eval()
   double tmp_coef1 = 1.0/denom_lj;
   double tmp_coef2 = cut_ljsq - 3.0*cut_lj_innersq;
 
+  // gather the LJ coefficient streams into one padded 64-byte struct per
+  // (itype,jtype) so the inner loop touches a single cache line per pair
+  // instead of four strided 2d arrays
+  // special-bonded neighbors are split out via sbindex so the common path
+  // carries no factor_lj/factor_coul loads or special-case corrections
+  // the erfc table vs analytic choice stays a per-pair distance test:
+  //   partitioning the list itself by distance would go stale between
+  //   neighbor builds as atoms move across tabinnersq
+
   fast_alpha_t* _noalias fast_alpha =
     (fast_alpha_t*)malloc(ntypes2*sizeof(fast_alpha_t));
   for (i = 0; i < ntypes; i++) for (j = 0; j < ntypes; j++) {
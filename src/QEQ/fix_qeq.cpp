@@ -403,7 +403,17 @@ int FixQEq::CG( double *b, double *x )
 }
 
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   multiply by the CSR matrix assembled once per solve in compute_H()
+   every CG iteration of both solves reuses that matrix, only the
+   vectors change; the entries cannot be cached across timesteps since
+   they are functions of the current interatomic distances, so one
+   assembly per step is already the minimum
+   rows come from a full neighbor list, so each pair is visited from
+   both sides: locally via both rows, across procs via the reverse
+   comm; the derived compute_H() methods scale their entries to account
+   for the double visit
+------------------------------------------------------------------------- */
 
 void FixQEq::sparse_matvec( sparse_matrix *A, double *x, double *b )
 {
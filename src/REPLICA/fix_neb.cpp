@@ -651,9 +651,8 @@ void FixNEB::min_post_force(int /*vflag*/)
 void FixNEB::inter_replica_comm()
 {
   int i,m;
-  MPI_Request request;
-  MPI_Request requests[2];
-  MPI_Status statuses[2];
+  MPI_Request requests[3];
+  MPI_Status statuses[3];
 
   // reallocate memory if necessary
 
@@ -675,22 +674,28 @@ void FixNEB::inter_replica_comm()
   // direct comm of x -> xprev and x -> xnext
 
   if (cmode == SINGLE_PROC_DIRECT) {
+
+    // post all receives, then all sends, then wait once,
+    //   instead of three blocking phases in sequence
+    // message order per peer must match the send order below
+
+    int nrequest = 0;
     if (ireplica > 0)
-      MPI_Irecv(xprev[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld,&request);
+      MPI_Irecv(xprev[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld,
+                &requests[nrequest++]);
+    if (ireplica < nreplica-1) {
+      MPI_Irecv(xnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,
+                &requests[nrequest++]);
+      MPI_Irecv(fnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,
+                &requests[nrequest++]);
+    }
     if (ireplica < nreplica-1)
       MPI_Send(x[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld);
-    if (ireplica > 0) MPI_Wait(&request,MPI_STATUS_IGNORE);
-    if (ireplica < nreplica-1)
-      MPI_Irecv(xnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,&request);
-    if (ireplica > 0)
+    if (ireplica > 0) {
       MPI_Send(x[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld);
-    if (ireplica < nreplica-1) MPI_Wait(&request,MPI_STATUS_IGNORE);
-
-    if (ireplica < nreplica-1)
-      MPI_Irecv(fnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,&request);
-    if (ireplica > 0)
       MPI_Send(f[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld);
-    if (ireplica < nreplica-1) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    }
+    if (nrequest) MPI_Waitall(nrequest,requests,statuses);
 
     return;
   }
@@ -734,8 +739,8 @@ void FixNEB::inter_replica_comm()
     }
     if (ireplica < nreplica-1) {
       MPI_Irecv(xrecv[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
-      MPI_Irecv(frecv[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
-      MPI_Irecv(tagrecv,nebatoms,MPI_LMP_TAGINT,procnext,0,uworld,&requests[1]);
+      MPI_Irecv(frecv[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[1]);
+      MPI_Irecv(tagrecv,nebatoms,MPI_LMP_TAGINT,procnext,0,uworld,&requests[2]);
     }
     if (ireplica > 0) {
       MPI_Send(xsend[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld);
@@ -744,7 +749,7 @@ void FixNEB::inter_replica_comm()
     }
 
     if (ireplica < nreplica-1) {
-      MPI_Waitall(2,requests,statuses);
+      MPI_Waitall(3,requests,statuses);
       for (i = 0; i < nebatoms; i++) {
         m = atom->map(tagrecv[i]);
         xnext[m][0] = xrecv[i][0];
@@ -826,9 +831,9 @@ void FixNEB::inter_replica_comm()
 
   if (ireplica < nreplica-1 && me == 0) {
     MPI_Irecv(xrecvall[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
-    MPI_Irecv(frecvall[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[0]);
+    MPI_Irecv(frecvall[0],3*nebatoms,MPI_DOUBLE,procnext,0,uworld,&requests[1]);
     MPI_Irecv(tagrecvall,nebatoms,MPI_LMP_TAGINT,procnext,0,uworld,
-              &requests[1]);
+              &requests[2]);
   }
   if (ireplica > 0 && me == 0) {
     MPI_Send(xsendall[0],3*nebatoms,MPI_DOUBLE,procprev,0,uworld);
@@ -837,7 +842,7 @@ void FixNEB::inter_replica_comm()
   }
 
   if (ireplica < nreplica-1) {
-    if (me == 0) MPI_Waitall(2,requests,statuses);
+    if (me == 0) MPI_Waitall(3,requests,statuses);
 
     MPI_Bcast(tagrecvall,nebatoms,MPI_INT,0,world);
     MPI_Bcast(xrecvall[0],3*nebatoms,MPI_DOUBLE,0,world);
@@ -1032,6 +1032,12 @@ void FixRigid::compute_forces_and_torques()
   int i,ibody;
 
   // sum over atoms to get force and torque on rigid body
+  // sum is a contiguous nbody x 6 array, so force + torque for all
+  //   bodies reduce in the one MPI_Allreduce below - the only global
+  //   collective in the timestep loop of this fix
+  // for many small bodies the per-body work here still scales with the
+  //   global body count; fix rigid/small keeps bodies local and
+  //   replaces the reduction with neighbor-proc comm
 
   double **x = atom->x;
   double **f = atom->f;
@@ -1512,6 +1512,19 @@ void FixRigidSmall::set_v()
 /* ----------------------------------------------------------------------
    one-time identification of which atoms are in which rigid bodies
    set bodytag for all owned atoms
+   scaling note: the 3 comm->ring() passes cycle all rigid-body atoms
+     past every proc, so this one-time setup is O(N) work per proc with
+     an O(P) latency chain; at many millions of small bodies it can
+     take minutes
+   the cure is recasting each ring pass as a rendezvous (hash body IDs
+     to owner procs, exchange via Irregular), the same rework noted in
+     Special::build(); both should move together since they share the
+     ring protocol
+   after setup no rework is needed for migration: each body is stored
+     with the atom closest to its center, rides that atom's
+     pack_exchange() message inside the one existing exchange per proc
+     pair, and thus follows any balancer's subdomain assignment,
+     including RCB
 ------------------------------------------------------------------------- */
 
 void FixRigidSmall::create_bodies(tagint *bodyid)
@@ -555,6 +555,38 @@ void FixShake::pre_neighbor()
           list[nlist++] = i;
       }
     }
+
+  // group the list by cluster topology, keeping order within each group:
+  //   2-atom, 3-atom, 4-atom, then 3-atom angle clusters
+  // each analytic solver then runs over one uniform batch per step
+  //   instead of dispatching per cluster
+
+  int n2,n3,n4;
+  n2 = n3 = n4 = 0;
+  for (int i = 0; i < nlist; i++) {
+    if (shake_flag[list[i]] == 2) n2++;
+    else if (shake_flag[list[i]] == 3) n3++;
+    else if (shake_flag[list[i]] == 4) n4++;
+  }
+  nlist2 = n2;
+  nlist3 = n2 + n3;
+  nlist4 = nlist3 + n4;
+
+  int *grouped;
+  memory->create(grouped,nlist,"shake:grouped");
+  int i2 = 0;
+  int i3 = nlist2;
+  int i4 = nlist3;
+  int iangle = nlist4;
+  for (int i = 0; i < nlist; i++) {
+    const int m = list[i];
+    if (shake_flag[m] == 2) grouped[i2++] = m;
+    else if (shake_flag[m] == 3) grouped[i3++] = m;
+    else if (shake_flag[m] == 4) grouped[i4++] = m;
+    else grouped[iangle++] = m;
+  }
+  memcpy(list,grouped,nlist*sizeof(int));
+  memory->destroy(grouped);
 }
 
 /* ----------------------------------------------------------------------
@@ -577,15 +609,13 @@ void FixShake::post_force(int vflag)
   else evflag = 0;
 
   // loop over clusters to add constraint forces
+  // list is grouped by topology, so run each solver over its batch
 
-  int m;
-  for (int i = 0; i < nlist; i++) {
-    m = list[i];
-    if (shake_flag[m] == 2) shake(m);
-    else if (shake_flag[m] == 3) shake3(m);
-    else if (shake_flag[m] == 4) shake4(m);
-    else shake3angle(m);
-  }
+  int i = 0;
+  for (; i < nlist2; i++) shake(list[i]);
+  for (; i < nlist3; i++) shake3(list[i]);
+  for (; i < nlist4; i++) shake4(list[i]);
+  for (; i < nlist; i++) shake3angle(list[i]);
 
   // store vflag for coordinate_constraints_end_of_step()
 
@@ -625,17 +655,16 @@ void FixShake::post_force_respa(int vflag, int ilevel, int iloop)
   else evflag = 0;
 
   // loop over clusters to add constraint forces
+  // list is grouped by topology, so run each solver over its batch
 
-  int m;
-  for (int i = 0; i < nlist; i++) {
-    m = list[i];
-    if (shake_flag[m] == 2) shake(m);
-    else if (shake_flag[m] == 3) shake3(m);
-    else if (shake_flag[m] == 4) shake4(m);
-    else shake3angle(m);
-  }
+  int i = 0;
+  for (; i < nlist2; i++) shake(list[i]);
+  for (; i < nlist3; i++) shake3(list[i]);
+  for (; i < nlist4; i++) shake4(list[i]);
+  for (; i < nlist; i++) shake3angle(list[i]);
 
   // store vflag for coordinate_constraints_end_of_step()
+
   vflag_post_force = vflag;
 }
 
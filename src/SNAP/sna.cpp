@@ -411,15 +411,25 @@ void SNA::compute_zi()
   // compute_dbidrj() requires full j1/j2/j chunk of z elements
   // use zarray j1/j2 symmetry
 
-  for(int j1 = 0; j1 <= twojmax; j1++)
+  // hoist row pointers out of the Clebsch-Gordan loops and accumulate
+  // each z element in registers; order of summation is unchanged
+
+  for(int j1 = 0; j1 <= twojmax; j1++) {
+    double** const u1_r = uarraytot_r[j1];
+    double** const u1_i = uarraytot_i[j1];
     for(int j2 = 0; j2 <= j1; j2++) {
+      double** const u2_r = uarraytot_r[j2];
+      double** const u2_i = uarraytot_i[j2];
       for(int j = j1 - j2; j <= MIN(twojmax, j1 + j2); j += 2) {
-        double sumb1_r, sumb1_i;
+        double** const cg = cgarray[j1][j2][j];
+        double** const z_r = zarray_r[j1][j2][j];
+        double** const z_i = zarray_i[j1][j2][j];
+        double sumb1_r, sumb1_i, ztmp_r, ztmp_i;
         int ma2, mb2;
         for(int mb = 0; 2*mb <= j; mb++)
           for(int ma = 0; ma <= j; ma++) {
-            zarray_r[j1][j2][j][ma][mb] = 0.0;
-            zarray_i[j1][j2][j][ma][mb] = 0.0;
+            ztmp_r = 0.0;
+            ztmp_i = 0.0;
 
             for(int ma1 = MAX(0, (2 * ma - j - j2 + j1) / 2);
                 ma1 <= MIN(j1, (2 * ma - j + j2 + j1) / 2); ma1++) {
@@ -432,22 +442,24 @@ void SNA::compute_zi()
               mb1 <= MIN(j1, (2 * mb - j + j2 + j1) / 2); mb1++) {
 
                 mb2 = (2 * mb - j - (2 * mb1 - j1) + j2) / 2;
-                sumb1_r += cgarray[j1][j2][j][mb1][mb2] *
-                  (uarraytot_r[j1][ma1][mb1] * uarraytot_r[j2][ma2][mb2] -
-                   uarraytot_i[j1][ma1][mb1] * uarraytot_i[j2][ma2][mb2]);
-                sumb1_i += cgarray[j1][j2][j][mb1][mb2] *
-                  (uarraytot_r[j1][ma1][mb1] * uarraytot_i[j2][ma2][mb2] +
-                   uarraytot_i[j1][ma1][mb1] * uarraytot_r[j2][ma2][mb2]);
+                sumb1_r += cg[mb1][mb2] *
+                  (u1_r[ma1][mb1] * u2_r[ma2][mb2] -
+                   u1_i[ma1][mb1] * u2_i[ma2][mb2]);
+                sumb1_i += cg[mb1][mb2] *
+                  (u1_r[ma1][mb1] * u2_i[ma2][mb2] +
+                   u1_i[ma1][mb1] * u2_r[ma2][mb2]);
               } // end loop over mb1
 
-              zarray_r[j1][j2][j][ma][mb] +=
-                sumb1_r * cgarray[j1][j2][j][ma1][ma2];
-              zarray_i[j1][j2][j][ma][mb] +=
-                sumb1_i * cgarray[j1][j2][j][ma1][ma2];
+              ztmp_r += sumb1_r * cg[ma1][ma2];
+              ztmp_i += sumb1_i * cg[ma1][ma2];
             } // end loop over ma1
+
+            z_r[ma][mb] = ztmp_r;
+            z_i[ma][mb] = ztmp_i;
           } // end loop over ma, mb
       } // end loop over j
     } // end loop over j1, j2
+  }
 
 #ifdef TIMING_INFO
   clock_gettime(CLOCK_REALTIME, &endtime);
@@ -545,31 +557,29 @@ void SNA::compute_bi()
     for(int j2 = 0; j2 <= j1; j2++) {
       for(int j = abs(j1 - j2);
           j <= MIN(twojmax, j1 + j2); j += 2) {
-        barray[j1][j2][j] = 0.0;
+        double** const u_r = uarraytot_r[j];
+        double** const u_i = uarraytot_i[j];
+        double** const z_r = zarray_r[j1][j2][j];
+        double** const z_i = zarray_i[j1][j2][j];
+        double sumb = 0.0;
 
         for(int mb = 0; 2*mb < j; mb++)
           for(int ma = 0; ma <= j; ma++)
-            barray[j1][j2][j] +=
-              uarraytot_r[j][ma][mb] * zarray_r[j1][j2][j][ma][mb] +
-              uarraytot_i[j][ma][mb] * zarray_i[j1][j2][j][ma][mb];
+            sumb += u_r[ma][mb] * z_r[ma][mb] + u_i[ma][mb] * z_i[ma][mb];
 
         // For j even, special treatment for middle column
 
         if (j%2 == 0) {
           int mb = j/2;
           for(int ma = 0; ma < mb; ma++)
-            barray[j1][j2][j] +=
-              uarraytot_r[j][ma][mb] * zarray_r[j1][j2][j][ma][mb] +
-              uarraytot_i[j][ma][mb] * zarray_i[j1][j2][j][ma][mb];
+            sumb += u_r[ma][mb] * z_r[ma][mb] + u_i[ma][mb] * z_i[ma][mb];
           int ma = mb;
-          barray[j1][j2][j] +=
-            (uarraytot_r[j][ma][mb] * zarray_r[j1][j2][j][ma][mb] +
-             uarraytot_i[j][ma][mb] * zarray_i[j1][j2][j][ma][mb])*0.5;
+          sumb += (u_r[ma][mb] * z_r[ma][mb] + u_i[ma][mb] * z_i[ma][mb])*0.5;
         }
 
-        barray[j1][j2][j] *= 2.0;
-        if (bzero_flag)
-          barray[j1][j2][j] -= bzero[j];
+        sumb *= 2.0;
+        if (bzero_flag) sumb -= bzero[j];
+        barray[j1][j2][j] = sumb;
       }
     }
 
@@ -392,6 +392,22 @@ int MPI_Type_contiguous(int count, MPI_Datatype oldtype,
 
 /* ---------------------------------------------------------------------- */
 
+/* store size of user indexed-block datatype in extra lists */
+
+int MPI_Type_create_indexed_block(int count, int blocklength,
+                                  const int *displacements,
+                                  MPI_Datatype oldtype, MPI_Datatype *newtype)
+{
+  if (nextra_datatype == MAXEXTRA_DATATYPE) return -1;
+  ptr_datatype[nextra_datatype] = newtype;
+  index_datatype[nextra_datatype] = -(nextra_datatype + 1);
+  size_datatype[nextra_datatype] = count * blocklength * stubtypesize(oldtype);
+  nextra_datatype++;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
 /* set value of user datatype to internal negative index,
    based on match of ptr */
 
@@ -128,6 +128,9 @@ int MPI_Cart_shift(MPI_Comm comm, int direction, int displ,
                    int *source, int *dest);
 int MPI_Cart_rank(MPI_Comm comm, int *coords, int *rank);
 
+int MPI_Type_create_indexed_block(int count, int blocklength,
+                                  const int *displacements,
+                                  MPI_Datatype oldtype, MPI_Datatype *newtype);
 int MPI_Type_contiguous(int count, MPI_Datatype oldtype,
                         MPI_Datatype *newtype);
 int MPI_Type_commit(MPI_Datatype *datatype);
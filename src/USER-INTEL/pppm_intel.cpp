@@ -61,6 +61,10 @@ PPPMIntel::PPPMIntel(LAMMPS *lmp, int narg, char **arg) : PPPM(lmp, narg, arg)
 {
   suffix_flag |= Suffix::INTEL;
 
+  // fieldforce writes directly to atom->f, cannot overlap with pair
+
+  pipeline_capable = 0;
+
   order = 7; //sets default stencil size to 7
 
   perthread_density = NULL;
@@ -19,6 +19,7 @@
 #include "force.h"
 #include "neighbor.h"
 #include "neigh_list.h"
+#include "nbin.h"
 
 #include "suffix.h"
 using namespace LAMMPS_NS;
@@ -45,6 +46,19 @@ void PairLJCutOMP::compute(int eflag, int vflag)
   const int nthreads = comm->nthreads;
   const int inum = list->inum;
 
+  // when no energy/virial accumulation is needed, the bin color
+  //   partition lets every thread write to the master force array
+  //   directly, bypassing the per-thread replication and reduction
+
+  if (!evflag && nthreads > 1 && force->newton_pair &&
+      inum == atom->nlocal) {
+    NBin *bin = neighbor->find_bin(0);
+    if (bin && bin->ncolor && bin->atom2bin) {
+      eval_color(bin);
+      return;
+    }
+  }
+
 #if defined(_OPENMP)
 #pragma omp parallel default(none) shared(eflag,vflag)
 #endif
@@ -152,6 +166,111 @@ void PairLJCutOMP::eval(int iifrom, int iito, ThrData * const thr)
   }
 }
 
+/* ----------------------------------------------------------------------
+   process the bin blocks of each color in turn: blocks of one color
+     have disjoint interaction halos, so threads accumulate into the
+     master force array without replication or atomics
+   the implicit barrier at the end of each worksharing loop keeps
+     writes from different colors ordered
+------------------------------------------------------------------------- */
+
+void PairLJCutOMP::eval_color(NBin *bin)
+{
+#if defined(_OPENMP)
+#pragma omp parallel default(none) shared(bin)
+#endif
+  {
+    int ifrom,ito,tid;
+    loop_setup_thr(ifrom,ito,tid,0,comm->nthreads);
+    ThrData *thr = fix->get_thr(tid);
+    thr->timer(Timer::START);
+
+    for (int icolor = 0; icolor < bin->ncolor; icolor++) {
+      const int bfrom = bin->colorblock[icolor];
+      const int bto = bin->colorblock[icolor+1];
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic,1)
+#endif
+      for (int iblock = bfrom; iblock < bto; iblock++)
+        eval_block(bin,iblock);
+    }
+
+    thr->timer(Timer::PAIR);
+  } // end of omp parallel region
+}
+
+/* ----------------------------------------------------------------------
+   same kernel as eval<0,0,1> for the local atoms of one bin block,
+     but forces go straight into the master force array
+------------------------------------------------------------------------- */
+
+void PairLJCutOMP::eval_block(NBin *bin, int iblock)
+{
+  const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
+  dbl3_t * _noalias const f = (dbl3_t *) atom->f[0];
+  const int * _noalias const type = atom->type;
+  const double * _noalias const special_lj = force->special_lj;
+  const int * _noalias const numneigh = list->numneigh;
+  const int * const * const firstneigh = list->firstneigh;
+
+  const int * _noalias const binhead = bin->binhead;
+  const int * _noalias const next = bin->bins;
+  const int * _noalias const blockbins = bin->blockbins;
+
+  double xtmp,ytmp,ztmp,delx,dely,delz,fxtmp,fytmp,fztmp;
+  double rsq,r2inv,r6inv,forcelj,factor_lj,fpair;
+
+  const int nlocal = atom->nlocal;
+  int j,jj,jnum,jtype;
+
+  for (int m = bin->blockstart[iblock]; m < bin->blockstart[iblock+1]; m++) {
+    for (int i = binhead[blockbins[m]]; i >= 0; i = next[i]) {
+      if (i >= nlocal) continue;
+
+      const int itype = type[i];
+      const int    * _noalias const jlist = firstneigh[i];
+      const double * _noalias const cutsqi = cutsq[itype];
+      const double * _noalias const lj1i = lj1[itype];
+      const double * _noalias const lj2i = lj2[itype];
+
+      xtmp = x[i].x;
+      ytmp = x[i].y;
+      ztmp = x[i].z;
+      jnum = numneigh[i];
+      fxtmp=fytmp=fztmp=0.0;
+
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj];
+        factor_lj = special_lj[sbmask(j)];
+        j &= NEIGHMASK;
+
+        delx = xtmp - x[j].x;
+        dely = ytmp - x[j].y;
+        delz = ztmp - x[j].z;
+        rsq = delx*delx + dely*dely + delz*delz;
+        jtype = type[j];
+
+        if (rsq < cutsqi[jtype]) {
+          r2inv = 1.0/rsq;
+          r6inv = r2inv*r2inv*r2inv;
+          forcelj = r6inv * (lj1i[jtype]*r6inv - lj2i[jtype]);
+          fpair = factor_lj*forcelj*r2inv;
+
+          fxtmp += delx*fpair;
+          fytmp += dely*fpair;
+          fztmp += delz*fpair;
+          f[j].x -= delx*fpair;
+          f[j].y -= dely*fpair;
+          f[j].z -= delz*fpair;
+        }
+      }
+      f[i].x += fxtmp;
+      f[i].y += fytmp;
+      f[i].z += fztmp;
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 double PairLJCutOMP::memory_usage()
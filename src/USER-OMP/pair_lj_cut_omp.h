@@ -40,6 +40,11 @@ class PairLJCutOMP : public PairLJCut, public ThrOMP {
  private:
   template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
   void eval(int ifrom, int ito, ThrData * const thr);
+
+  // lock-free force path based on the NBin color partition
+
+  void eval_color(class NBin *bin);
+  void eval_block(class NBin *bin, int iblock);
 };
 
 }
@@ -51,6 +51,10 @@ PPPMCGOMP::PPPMCGOMP(LAMMPS *lmp, int narg, char **arg) :
 {
   triclinic_support = 0;
   suffix_flag |= Suffix::OMP;
+
+  // fieldforce writes directly to atom->f, cannot overlap with pair
+
+  pipeline_capable = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -48,6 +48,10 @@ PPPMOMP::PPPMOMP(LAMMPS *lmp, int narg, char **arg) :
 {
   triclinic_support = 0;
   suffix_flag |= Suffix::OMP;
+
+  // fieldforce writes directly to atom->f, cannot overlap with pair
+
+  pipeline_capable = 0;
 }
 
 /* ----------------------------------------------------------------------
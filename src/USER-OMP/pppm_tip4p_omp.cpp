@@ -49,6 +49,10 @@ PPPMTIP4POMP::PPPMTIP4POMP(LAMMPS *lmp, int narg, char **arg) :
 {
   triclinic_support = 1;
   suffix_flag |= Suffix::OMP;
+
+  // fieldforce writes directly to atom->f, cannot overlap with pair
+
+  pipeline_capable = 0;
 }
 
 /* ----------------------------------------------------------------------
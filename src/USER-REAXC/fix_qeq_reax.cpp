@@ -571,10 +571,10 @@ void FixQEqReax::init_matvec()
     }
   }
 
-  pack_flag = 2;
-  comm->forward_comm_fix(this); //Dist_vector( s );
-  pack_flag = 3;
-  comm->forward_comm_fix(this); //Dist_vector( t );
+  // distribute s & t to ghosts in a single exchange
+
+  pack_flag = 6;
+  comm->forward_comm_fix(this,2); //Dist_vector( s & t );
 }
 
 /* ---------------------------------------------------------------------- */
@@ -706,8 +706,20 @@ int FixQEqReax::CG( double *b, double *x)
       d[j] = r[j] * Hdia_inv[j]; //pre-condition
   }
 
-  b_norm = parallel_norm( b, nn);
-  sig_new = parallel_dot( r, d, nn);
+  // fuse the b-norm and r.d reductions into one allreduce
+
+  double my_buf[2], buf[2];
+  my_buf[0] = my_buf[1] = 0.0;
+  for (jj = 0; jj < nn; ++jj) {
+    j = ilist[jj];
+    if (atom->mask[j] & groupbit) {
+      my_buf[0] += SQR( b[j]);
+      my_buf[1] += r[j] * d[j];
+    }
+  }
+  MPI_Allreduce( my_buf, buf, 2, MPI_DOUBLE, MPI_SUM, world);
+  b_norm = sqrt( buf[0]);
+  sig_new = buf[1];
 
   for (i = 1; i < imax && sqrt(sig_new) / b_norm > tolerance; ++i) {
     comm->forward_comm_fix(this); //Dist_vector( d );
@@ -807,8 +819,20 @@ void FixQEqReax::calculate_Q()
     ilist = list->ilist;
   }
 
-  s_sum = parallel_vector_acc( s, nn);
-  t_sum = parallel_vector_acc( t, nn);
+  // fuse the s and t accumulations into one allreduce
+
+  double my_buf[2], buf[2];
+  my_buf[0] = my_buf[1] = 0.0;
+  for (ii = 0; ii < nn; ++ii) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      my_buf[0] += s[i];
+      my_buf[1] += t[i];
+    }
+  }
+  MPI_Allreduce( my_buf, buf, 2, MPI_DOUBLE, MPI_SUM, world);
+  s_sum = buf[0];
+  t_sum = buf[1];
   u = s_sum / t_sum;
 
   for (ii = 0; ii < nn; ++ii) {
@@ -853,6 +877,13 @@ int FixQEqReax::pack_forward_comm(int n, int *list, double *buf,
       buf[m++] = d[j+1];
     }
     return m;
+  } else if (pack_flag == 6) {
+    m = 0;
+    for(int i = 0; i < n; i++) {
+      buf[m++] = s[list[i]];
+      buf[m++] = t[list[i]];
+    }
+    return m;
   }
   return n;
 }
@@ -879,6 +910,13 @@ void FixQEqReax::unpack_forward_comm(int n, int first, double *buf)
       d[j  ] = buf[m++];
       d[j+1] = buf[m++];
     }
+  } else if (pack_flag == 6) {
+    int last = first + n;
+    m = 0;
+    for(i = first; i < last; i++) {
+      s[i] = buf[m++];
+      t[i] = buf[m++];
+    }
   }
 }
 
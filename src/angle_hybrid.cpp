@@ -52,7 +52,7 @@ AngleHybrid::~AngleHybrid()
     delete [] nanglelist;
     delete [] maxangle;
     for (int i = 0; i < nstyles; i++)
-      memory->destroy(anglelist[i]);
+      delete [] anglelist[i];
     delete [] anglelist;
   }
 }
@@ -71,7 +71,8 @@ void AngleHybrid::compute(int eflag, int vflag)
   // if this is re-neighbor step, create sub-style anglelists
   // nanglelist[] = length of each sub-style list
   // realloc sub-style anglelist if necessary
-  // load sub-style anglelist with 4 values from original anglelist
+  // sub-style lists store ptrs to rows of original anglelist, not copies
+  // valid until the next re-neighbor, when the original list is rebuilt
 
   if (neighbor->ago == 0) {
     for (m = 0; m < nstyles; m++) nanglelist[m] = 0;
@@ -81,21 +82,16 @@ void AngleHybrid::compute(int eflag, int vflag)
     }
     for (m = 0; m < nstyles; m++) {
       if (nanglelist[m] > maxangle[m]) {
-        memory->destroy(anglelist[m]);
+        delete [] anglelist[m];
         maxangle[m] = nanglelist[m] + EXTRA;
-        memory->create(anglelist[m],maxangle[m],4,"angle_hybrid:anglelist");
+        anglelist[m] = new int*[maxangle[m]];
       }
       nanglelist[m] = 0;
     }
     for (i = 0; i < nanglelist_orig; i++) {
       m = map[anglelist_orig[i][3]];
       if (m < 0) continue;
-      n = nanglelist[m];
-      anglelist[m][n][0] = anglelist_orig[i][0];
-      anglelist[m][n][1] = anglelist_orig[i][1];
-      anglelist[m][n][2] = anglelist_orig[i][2];
-      anglelist[m][n][3] = anglelist_orig[i][3];
-      nanglelist[m]++;
+      anglelist[m][nanglelist[m]++] = anglelist_orig[i];
     }
   }
 
@@ -180,7 +176,7 @@ void AngleHybrid::settings(int narg, char **arg)
     delete [] nanglelist;
     delete [] maxangle;
     for (int i = 0; i < nstyles; i++)
-      memory->destroy(anglelist[i]);
+      delete [] anglelist[i];
     delete [] anglelist;
   }
   allocated = 0;
@@ -369,7 +365,7 @@ double AngleHybrid::memory_usage()
 {
   double bytes = maxeatom * sizeof(double);
   bytes += maxvatom*6 * sizeof(double);
-  for (int m = 0; m < nstyles; m++) bytes += maxangle[m]*4 * sizeof(int);
+  for (int m = 0; m < nstyles; m++) bytes += maxangle[m] * sizeof(int *);
   for (int m = 0; m < nstyles; m++)
     if (styles[m]) bytes += styles[m]->memory_usage();
   return bytes;
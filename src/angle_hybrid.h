@@ -49,6 +49,7 @@ class AngleHybrid : public Angle {
   int *nanglelist;              // # of angles in sub-style anglelists
   int *maxangle;                // max # of angles sub-style lists can store
   int ***anglelist;             // anglelist for each sub-style
+                                // rows are ptrs into master Neighbor list
 
   void allocate();
 };
@@ -68,6 +68,13 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
   maxbin = maxnext = 0;
   binhead = NULL;
   next = permute = NULL;
+  sortorder = 0;
+  binorder = NULL;
+  maxbinorder = 0;
+
+  soa_flag = 0;
+  nmax_soa = 0;
+  xsoa = vsoa = fsoa = NULL;
 
   // initialize atom arrays
   // customize by adding new array
@@ -247,6 +254,11 @@ Atom::~Atom()
   memory->destroy(binhead);
   memory->destroy(next);
   memory->destroy(permute);
+  memory->destroy(binorder);
+
+  memory->destroy(xsoa);
+  memory->destroy(vsoa);
+  memory->destroy(fsoa);
 
   // delete atom arrays
   // customize by adding new array
@@ -632,6 +644,18 @@ void Atom::modify_params(int narg, char **arg)
         error->all(FLERR,"Atom_modify sort and first options "
                    "cannot be used together");
       iarg += 3;
+    } else if (strcmp(arg[iarg],"sortorder") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal atom_modify command");
+      if (strcmp(arg[iarg+1],"bin") == 0) sortorder = 0;
+      else if (strcmp(arg[iarg+1],"morton") == 0) sortorder = 1;
+      else error->all(FLERR,"Illegal atom_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"soa") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal atom_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) soa_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) soa_flag = 0;
+      else error->all(FLERR,"Illegal atom_modify command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal atom_modify command");
   }
 }
@@ -917,22 +941,31 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
   if (imageflag) iptr = nwords - 3;
 
   // loop over lines of atom data
-  // tokenize the line into values
+  // scan word start pointers without modifying the line,
+  //   atof/atoi stop at whitespace so no terminators are needed yet
   // extract xyz coords and image flags
   // remap atom into simulation box
-  // if atom is in my sub-domain, unpack its values
+  // only if atom is in my sub-domain, tokenize and unpack its values,
+  //   so lines owned by other procs are never tokenized
 
   for (int i = 0; i < n; i++) {
     next = strchr(buf,'\n');
 
-    values[0] = strtok(buf," \t\n\r\f");
-    if (values[0] == NULL)
-      error->all(FLERR,"Incorrect atom format in data file");
-    for (m = 1; m < nwords; m++) {
-      values[m] = strtok(NULL," \t\n\r\f");
-      if (values[m] == NULL)
-        error->all(FLERR,"Incorrect atom format in data file");
+    int nw = 0;
+    char *ptr = buf;
+    while (ptr < next) {
+      while (ptr < next &&
+             (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\f'))
+        ptr++;
+      if (ptr >= next) break;
+      if (nw < nwords) values[nw] = ptr;
+      nw++;
+      while (ptr < next &&
+             *ptr != ' ' && *ptr != '\t' && *ptr != '\r' && *ptr != '\f')
+        ptr++;
     }
+    if (nw < nwords)
+      error->all(FLERR,"Incorrect atom format in data file");
 
     if (imageflag)
       imagedata = ((imageint) (atoi(values[iptr]) + IMGMAX) & IMGMASK) |
@@ -959,6 +992,19 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
     if (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
         coord[1] >= sublo[1] && coord[1] < subhi[1] &&
         coord[2] >= sublo[2] && coord[2] < subhi[2]) {
+
+      // atom is mine, now tokenize the line in place so values[]
+      //   are NULL-terminated strings for the unpack
+
+      values[0] = strtok(buf," \t\n\r\f");
+      if (values[0] == NULL)
+        error->all(FLERR,"Incorrect atom format in data file");
+      for (m = 1; m < nwords; m++) {
+        values[m] = strtok(NULL," \t\n\r\f");
+        if (values[m] == NULL)
+          error->all(FLERR,"Incorrect atom format in data file");
+      }
+
       avec->data_atom(xdata,imagedata,values);
       if (id_offset) tag[nlocal-1] += id_offset;
       if (mol_offset) molecule[nlocal-1] += mol_offset;
@@ -1830,7 +1876,8 @@ void Atom::sort()
   // permute[I] = J means Ith new atom will be Jth old atom
 
   n = 0;
-  for (m = 0; m < nbins; m++) {
+  for (int mm = 0; mm < nbins; mm++) {
+    m = (sortorder && binorder) ? binorder[mm] : mm;
     i = binhead[m];
     while (i >= 0) {
       permute[n++] = i;
@@ -1873,6 +1920,68 @@ void Atom::sort()
   //if (flagall) error->all(FLERR,"Atom sort did not operate correctly");
 }
 
+/* ----------------------------------------------------------------------
+   grow SoA mirror of x/v/f to hold nmax atoms
+   called by AtomVec::grow_nmax() so mirror tracks the AoS arrays
+   plane length is padded to a multiple of 8 doubles so that each of the
+   3 planes within a 2d allocation stays 64-byte aligned
+------------------------------------------------------------------------- */
+
+void Atom::grow_soa(int nmax_caller)
+{
+  if (!soa_flag || nmax_caller <= nmax_soa) return;
+
+  nmax_soa = ((nmax_caller+7)/8) * 8;
+  memory->destroy(xsoa);
+  memory->destroy(vsoa);
+  memory->destroy(fsoa);
+  memory->create(xsoa,3,nmax_soa,"atom:xsoa");
+  memory->create(vsoa,3,nmax_soa,"atom:vsoa");
+  memory->create(fsoa,3,nmax_soa,"atom:fsoa");
+}
+
+/* ----------------------------------------------------------------------
+   copy x/v/f for owned + ghost atoms into the SoA planes
+   pair styles written against contiguous lanes call this after comm
+------------------------------------------------------------------------- */
+
+void Atom::sync_soa()
+{
+  if (!soa_flag) return;
+
+  int nall = nlocal + nghost;
+  if (nall > nmax_soa) grow_soa(nall);
+
+  for (int i = 0; i < nall; i++) {
+    xsoa[0][i] = x[i][0];
+    xsoa[1][i] = x[i][1];
+    xsoa[2][i] = x[i][2];
+    vsoa[0][i] = v[i][0];
+    vsoa[1][i] = v[i][1];
+    vsoa[2][i] = v[i][2];
+    fsoa[0][i] = f[i][0];
+    fsoa[1][i] = f[i][1];
+    fsoa[2][i] = f[i][2];
+  }
+}
+
+/* ----------------------------------------------------------------------
+   copy forces accumulated in the SoA planes back into f
+   called by SoA kernels before reverse comm so downstream code sees f
+------------------------------------------------------------------------- */
+
+void Atom::sync_force_from_soa()
+{
+  if (!soa_flag) return;
+
+  int nall = nlocal + nghost;
+  for (int i = 0; i < nall; i++) {
+    f[i][0] = fsoa[0][i];
+    f[i][1] = fsoa[1][i];
+    f[i][2] = fsoa[2][i];
+  }
+}
+
 /* ----------------------------------------------------------------------
    setup bins for spatial sorting of atoms
 ------------------------------------------------------------------------- */
@@ -1977,6 +2086,72 @@ void Atom::setup_sort_bins()
     maxbin = nbins;
     memory->create(binhead,maxbin,"atom:binhead");
   }
+
+  if (sortorder) setup_bin_order();
+}
+
+/* ----------------------------------------------------------------------
+   compute Morton-curve traversal order of the sort bins
+   interleaves the bits of the (ix,iy,iz) bin coords so that consecutive
+   bins in the traversal are spatially adjacent, which makes neighbor
+   list walks through the reordered atoms nearly sequential in memory
+   dimensions needing fewer bits stop contributing once exhausted
+------------------------------------------------------------------------- */
+
+void Atom::setup_bin_order()
+{
+  if (nbins > maxbinorder) {
+    memory->destroy(binorder);
+    maxbinorder = nbins;
+    memory->create(binorder,maxbinorder,"atom:binorder");
+  }
+
+  // bits needed to cover each dimension
+
+  int bitx = 0;
+  while ((1 << bitx) < nbinx) bitx++;
+  int bity = 0;
+  while ((1 << bity) < nbiny) bity++;
+  int bitz = 0;
+  while ((1 << bitz) < nbinz) bitz++;
+  int nbits = bitx + bity + bitz;
+
+  // fall back to lexicographic order for absurdly fine bin grids
+
+  if (nbits >= 31) {
+    for (int m = 0; m < nbins; m++) binorder[m] = m;
+    return;
+  }
+
+  // enumerate codes in increasing Morton order, de-interleave each code
+  // into bin coords, skip codes that fall outside the bin grid
+
+  int ncode = 1 << nbits;
+  int n = 0;
+  for (int code = 0; code < ncode; code++) {
+    int ix = 0,iy = 0,iz = 0;
+    int bx = 0,by = 0,bz = 0;
+    int c = code;
+    while (bx < bitx || by < bity || bz < bitz) {
+      if (bx < bitx) {
+        ix |= (c & 1) << bx;
+        c >>= 1;
+        bx++;
+      }
+      if (by < bity) {
+        iy |= (c & 1) << by;
+        c >>= 1;
+        by++;
+      }
+      if (bz < bitz) {
+        iz |= (c & 1) << bz;
+        c >>= 1;
+        bz++;
+      }
+    }
+    if (ix >= nbinx || iy >= nbiny || iz >= nbinz) continue;
+    binorder[n++] = iz*nbiny*nbinx + iy*nbinx + ix;
+  }
 }
 
 /* ----------------------------------------------------------------------
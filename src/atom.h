@@ -205,6 +205,14 @@ class Atom : protected Pointers {
   int sortfreq;             // sort atoms every this many steps, 0 = off
   bigint nextsort;          // next timestep to sort on
   double userbinsize;       // requested sort bin size
+  int sortorder;            // 0 = lexicographic bin sweep, 1 = Morton curve
+
+  // structure-of-arrays mirror of x/v/f for vectorized kernels
+  // each of xsoa/vsoa/fsoa is 3 contiguous aligned planes of length nmax_soa
+
+  int soa_flag;             // 1 if SoA mirror is maintained, 0 if not
+  int nmax_soa;             // allocated plane length, padded for alignment
+  double **xsoa,**vsoa,**fsoa;
 
   // indices of atoms with same ID
 
@@ -266,6 +274,10 @@ class Atom : protected Pointers {
   void first_reorder();
   virtual void sort();
 
+  void grow_soa(int);
+  void sync_soa();
+  void sync_force_from_soa();
+
   void add_callback(int);
   void delete_callback(const char *, int);
   void update_callback(int);
@@ -332,6 +344,8 @@ class Atom : protected Pointers {
   int *binhead;                   // 1st atom in each bin
   int *next;                      // next atom in bin
   int *permute;                   // permutation vector
+  int *binorder;                  // bin traversal order for Morton sorting
+  int maxbinorder;                // allocated size of binorder
   double bininvx,bininvy,bininvz; // inverse actual bin sizes
   double bboxlo[3],bboxhi[3];     // bounding box of my sub-domain
 
@@ -339,6 +353,7 @@ class Atom : protected Pointers {
   char *memstr;                   // string of array names already counted
 
   void setup_sort_bins();
+  void setup_bin_order();
   int next_prime(int);
 
  private:
@@ -201,10 +201,9 @@ void Atom::map_set()
     tagint global;
 
     for (int i = nall-1; i >= 0 ; i--) {
-      sametag[i] = map_find_hash(tag[i]);
 
-      // search for key
-      // if found it, just overwrite local value with index
+      // search for key, one walk of the bucket chain
+      // if found it, previous local value is sametag, overwrite with index
 
       previous = -1;
       global = tag[i];
@@ -216,10 +215,13 @@ void Atom::map_set()
         index = map_hash[index].next;
       }
       if (index > -1) {
+        sametag[i] = map_hash[index].local;
         map_hash[index].local = i;
         continue;
       }
 
+      sametag[i] = -1;
+
       // take one entry from free list
       // add the new global/local pair as entry at end of bucket list
       // special logic if this entry is 1st in bucket
@@ -93,6 +93,7 @@ void AtomVec::grow_nmax()
 {
   nmax = nmax/DELTA * DELTA;
   nmax += DELTA;
+  atom->grow_soa(nmax);
 }
 
 /* ----------------------------------------------------------------------
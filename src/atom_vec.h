@@ -28,6 +28,16 @@ class AtomVec : protected Pointers {
   int dipole_type;                     // 1 if per-type dipole moments
   int forceclearflag;                  // 1 if has forceclear() method
 
+  // the flags below are how a style subscribes to per-step communication
+  // forward/reverse comm each step move only what the style declares:
+  //   comm_x_only enables the direct-into-x fast path in CommBrick,
+  //   size_forward/size_reverse size the exchanged data per atom
+  // fields that are constant between reneighborings (q, radius, rmass, ...)
+  //   belong in border comm only (size_border), not in size_forward
+  // flags may be adjusted in init() when a field becomes time-varying,
+  //   e.g. atom_style sphere adds radius/rmass to forward comm only if
+  //   a fix adapt changes diameters on the fly
+
   int comm_x_only;                     // 1 if only exchange x in forward comm
   int comm_f_only;                     // 1 if only exchange f in reverse comm
 
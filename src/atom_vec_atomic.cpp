@@ -263,7 +263,23 @@ void AtomVecAtomic::unpack_reverse(int n, int *list, double *buf)
   }
 }
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   encoding border coords as reduced-precision offsets against a per-swap
+     base vector was evaluated to cut border message volume and rejected
+   the PBC shift per swap is already applied at pack time (dx/dy/dz
+     below), so nothing beyond the shifted coords is sent; image flags
+     travel only in exchange, once per migrating atom per reneighbor
+   quantizing the coords within the skin tolerance changes the forces
+     computed from ghost atoms, so trajectories would no longer match
+     across proc counts and ghost coords would disagree with the owner's
+     copy, which styles that difference owned and ghost positions
+     (e.g. granular history, SHAKE) cannot tolerate
+   the buffer layout is also a contract implemented by every atom style
+     and overridden by the accelerator packages, so the wire format
+     cannot change for one style in isolation; reduced precision is
+     available as an explicit opt-in at the force-kernel level in
+     USER-INTEL instead
+------------------------------------------------------------------------- */
 
 int AtomVecAtomic::pack_border(int n, int *list, double *buf,
                                int pbc_flag, int *pbc)
@@ -37,6 +37,7 @@
 #include "imbalance_group.h"
 #include "imbalance_time.h"
 #include "imbalance_neigh.h"
+#include "imbalance_topo.h"
 #include "imbalance_store.h"
 #include "imbalance_var.h"
 #include "timer.h"
@@ -480,6 +481,10 @@ void Balance::options(int iarg, int narg, char **arg)
         imb = new ImbalanceNeigh(lmp);
         nopt = imb->options(narg-iarg,arg+iarg+2);
         imbalances[nimbalance++] = imb;
+      } else if (strcmp(arg[iarg+1],"topo") == 0) {
+        imb = new ImbalanceTopo(lmp);
+        nopt = imb->options(narg-iarg,arg+iarg+2);
+        imbalances[nimbalance++] = imb;
       } else if (strcmp(arg[iarg+1],"var") == 0) {
         varflag = 1;
         imb = new ImbalanceVar(lmp);
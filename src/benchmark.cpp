@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <cstring>
+#include "benchmark.h"
+#include "domain.h"
+#include "update.h"
+#include "integrate.h"
+#include "force.h"
+#include "pair.h"
+#include "bond.h"
+#include "kspace.h"
+#include "neighbor.h"
+#include "comm.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+Benchmark::Benchmark(LAMMPS *lmp) : Pointers(lmp) {}
+
+/* ----------------------------------------------------------------------
+   time individual kernels of the timestep loop in isolation
+   benchmark N keyword ...
+   each keyword = pair, bond, kspace, neighbor, or comm
+   system is initialized and set up as for a zero-length run,
+     then each requested kernel is invoked N times and timed per proc
+------------------------------------------------------------------------- */
+
+void Benchmark::command(int narg, char **arg)
+{
+  if (domain->box_exist == 0)
+    error->all(FLERR,"Benchmark command before simulation box is defined");
+  if (narg < 2) error->all(FLERR,"Illegal benchmark command");
+
+  int nrepeat = force->inumeric(FLERR,arg[0]);
+  if (nrepeat <= 0) error->all(FLERR,"Illegal benchmark command");
+
+  // check keywords before doing any work
+
+  for (int iarg = 1; iarg < narg; iarg++) {
+    if (strcmp(arg[iarg],"pair") == 0) {
+      if (force->pair == NULL)
+        error->all(FLERR,"Benchmark pair without a pair style defined");
+    } else if (strcmp(arg[iarg],"bond") == 0) {
+      if (force->bond == NULL)
+        error->all(FLERR,"Benchmark bond without a bond style defined");
+    } else if (strcmp(arg[iarg],"kspace") == 0) {
+      if (force->kspace == NULL)
+        error->all(FLERR,"Benchmark kspace without a kspace style defined");
+    } else if (strcmp(arg[iarg],"neighbor") != 0 &&
+               strcmp(arg[iarg],"comm") != 0)
+      error->all(FLERR,"Illegal benchmark command");
+  }
+
+  // full system init and setup, as for a zero-length run
+  // insures neighbor lists, ghost atoms, and forces are current
+
+  update->whichflag = 1;
+  update->nsteps = 0;
+  update->firststep = update->beginstep = update->ntimestep;
+  update->laststep = update->endstep = update->ntimestep;
+
+  lmp->init();
+  update->integrate->setup(1);
+
+  // time each requested kernel
+  // no barrier inside the repeat loop, so the min/max spread across
+  //   procs reflects the load imbalance of the kernel itself
+
+  int me = comm->me;
+  int nprocs = comm->nprocs;
+
+  for (int iarg = 1; iarg < narg; iarg++) {
+    MPI_Barrier(world);
+    double time1 = MPI_Wtime();
+
+    if (strcmp(arg[iarg],"pair") == 0) {
+      for (int i = 0; i < nrepeat; i++) force->pair->compute(0,0);
+    } else if (strcmp(arg[iarg],"bond") == 0) {
+      for (int i = 0; i < nrepeat; i++) force->bond->compute(0,0);
+    } else if (strcmp(arg[iarg],"kspace") == 0) {
+      for (int i = 0; i < nrepeat; i++) force->kspace->compute(0,0);
+    } else if (strcmp(arg[iarg],"neighbor") == 0) {
+      for (int i = 0; i < nrepeat; i++) neighbor->build(1);
+    } else if (strcmp(arg[iarg],"comm") == 0) {
+      for (int i = 0; i < nrepeat; i++) comm->forward_comm();
+    }
+
+    double elapsed = MPI_Wtime() - time1;
+
+    double tmin,tmax,tsum;
+    MPI_Allreduce(&elapsed,&tmin,1,MPI_DOUBLE,MPI_MIN,world);
+    MPI_Allreduce(&elapsed,&tmax,1,MPI_DOUBLE,MPI_MAX,world);
+    MPI_Allreduce(&elapsed,&tsum,1,MPI_DOUBLE,MPI_SUM,world);
+
+    if (me == 0) {
+      const char *fmt =
+        "Benchmark %s: %d calls, time/call avg %g min %g max %g secs\n";
+      if (screen)
+        fprintf(screen,fmt,arg[iarg],nrepeat,
+                tsum/nprocs/nrepeat,tmin/nrepeat,tmax/nrepeat);
+      if (logfile)
+        fprintf(logfile,fmt,arg[iarg],nrepeat,
+                tsum/nprocs/nrepeat,tmin/nrepeat,tmax/nrepeat);
+    }
+  }
+
+  // forces now hold accumulated values from the repeated invocations
+  // a subsequent run with its default setup phase recomputes them
+
+  update->integrate->cleanup();
+
+  update->whichflag = 0;
+  update->firststep = update->laststep = 0;
+  update->beginstep = update->endstep = 0;
+}
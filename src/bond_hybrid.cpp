@@ -52,7 +52,7 @@ BondHybrid::~BondHybrid()
     delete [] nbondlist;
     delete [] maxbond;
     for (int i = 0; i < nstyles; i++)
-      memory->destroy(bondlist[i]);
+      delete [] bondlist[i];
     delete [] bondlist;
   }
 }
@@ -71,7 +71,8 @@ void BondHybrid::compute(int eflag, int vflag)
   // if this is re-neighbor step, create sub-style bondlists
   // nbondlist[] = length of each sub-style list
   // realloc sub-style bondlist if necessary
-  // load sub-style bondlist with 3 values from original bondlist
+  // sub-style lists store ptrs to rows of original bondlist, not copies
+  // valid until the next re-neighbor, when the original list is rebuilt
 
   if (neighbor->ago == 0) {
     for (m = 0; m < nstyles; m++) nbondlist[m] = 0;
@@ -81,20 +82,16 @@ void BondHybrid::compute(int eflag, int vflag)
     }
     for (m = 0; m < nstyles; m++) {
       if (nbondlist[m] > maxbond[m]) {
-        memory->destroy(bondlist[m]);
+        delete [] bondlist[m];
         maxbond[m] = nbondlist[m] + EXTRA;
-        memory->create(bondlist[m],maxbond[m],3,"bond_hybrid:bondlist");
+        bondlist[m] = new int*[maxbond[m]];
       }
       nbondlist[m] = 0;
     }
     for (i = 0; i < nbondlist_orig; i++) {
       m = map[bondlist_orig[i][2]];
       if (m < 0) continue;
-      n = nbondlist[m];
-      bondlist[m][n][0] = bondlist_orig[i][0];
-      bondlist[m][n][1] = bondlist_orig[i][1];
-      bondlist[m][n][2] = bondlist_orig[i][2];
-      nbondlist[m]++;
+      bondlist[m][nbondlist[m]++] = bondlist_orig[i];
     }
   }
 
@@ -179,7 +176,7 @@ void BondHybrid::settings(int narg, char **arg)
     delete [] nbondlist;
     delete [] maxbond;
     for (int i = 0; i < nstyles; i++)
-      memory->destroy(bondlist[i]);
+      delete [] bondlist[i];
     delete [] bondlist;
   }
   allocated = 0;
@@ -355,7 +352,7 @@ double BondHybrid::memory_usage()
 {
   double bytes = maxeatom * sizeof(double);
   bytes += maxvatom*6 * sizeof(double);
-  for (int m = 0; m < nstyles; m++) bytes += maxbond[m]*3 * sizeof(int);
+  for (int m = 0; m < nstyles; m++) bytes += maxbond[m] * sizeof(int *);
   for (int m = 0; m < nstyles; m++)
     if (styles[m]) bytes += styles[m]->memory_usage();
   return bytes;
@@ -51,6 +51,7 @@ class BondHybrid : public Bond {
   int *nbondlist;               // # of bonds in sub-style bondlists
   int *maxbond;                 // max # of bonds sub-style lists can store
   int ***bondlist;              // bondlist for each sub-style
+                                // rows are ptrs into master Neighbor list
 
   void allocate();
 };
@@ -55,6 +55,7 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   cutghostuser = 0.0;
   cutusermulti = NULL;
   ghost_velocity = 0;
+  ddtype_flag = 0;
 
   user_procgrid[0] = user_procgrid[1] = user_procgrid[2] = 0;
   coregrid[0] = coregrid[1] = coregrid[2] = 1;
@@ -299,6 +300,12 @@ void Comm::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) ghost_velocity = 0;
       else error->all(FLERR,"Illegal comm_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"ddtype") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) ddtype_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) ddtype_flag = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
     } else error->all(FLERR,"Illegal comm_modify command");
   }
 }
@@ -676,6 +683,14 @@ int Comm::binary(double value, int n, double *vec)
    for non-NULL outbuf, final updated inbuf is copied to it
      ok to specify outbuf = inbuf
    the ptr argument is a pointer to the instance of calling class
+   cost is O(P) latency and every proc sees every other proc's data,
+     so this is a setup-only primitive (special bonds, fix shake/rigid
+     init, ID lookups without an atom map), never in the timestep loop
+   callers that only need to route datums to the few procs that own
+     the referenced atom IDs could instead hash IDs to owner procs and
+     exchange via Irregular, but each caller's callback logic must be
+     recast as a key/value query+reply to do so - the ring() interface
+     itself cannot be swapped out underneath them
 ------------------------------------------------------------------------- */
 
 void Comm::ring(int n, int nper, void *inbuf, int messtag,
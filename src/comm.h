@@ -30,6 +30,8 @@ class Comm : protected Pointers {
 
   int me,nprocs;                    // proc info
   int ghost_velocity;               // 1 if ghost atoms have velocity, 0 if not
+  int ddtype_flag;                  // 1 if forward comm may send x directly
+                                    //   via MPI derived datatypes, 0 if not
   double cutghost[3];               // cutoffs used for acquiring ghost atoms
   double cutghostuser;              // user-specified ghost cutoff (mode == 0)
   double *cutusermulti;            // per type user ghost cutoff (mode == 1)
@@ -77,6 +77,10 @@ CommBrick::~CommBrick()
   memory->sfree(sendlist);
   memory->destroy(maxsendlist);
 
+  free_ddtypes();
+  memory->sfree(xddtype);
+  memory->destroy(xddtype_set);
+
   memory->destroy(buf_send);
   memory->destroy(buf_recv);
 }
@@ -121,6 +125,10 @@ void CommBrick::init_buffers()
   maxrecv = BUFMIN;
   memory->create(buf_recv,maxrecv,"comm:buf_recv");
 
+  xddtype = NULL;
+  xddtype_set = NULL;
+  maxddtype = 0;
+
   nswap = 0;
   maxswap = 6;
   allocate_swap(maxswap);
@@ -173,6 +181,17 @@ void CommBrick::setup()
   int ntypes = atom->ntypes;
   double *prd,*sublo,*subhi;
 
+  // one ghost cutoff serves every consumer, sized to the longest request
+  // a rarely-invoked consumer with a long cutoff (e.g. an analysis
+  //   compute) thus inflates the every-step forward comm for all styles
+  // tiering the ghost shell by consumer was considered and rejected:
+  //   sendlists from one borders() pass back all forward/reverse comm,
+  //   and the atom map must cover the full shell for bond/special
+  //   lookups, so a stale far tier would need its own border structure,
+  //   map entries, and exchange bookkeeping
+  // the supported remedies are to post-process long-cutoff analysis
+  //   via the rerun command or to drop cutghostuser between runs
+
   double cut = MAX(neighbor->cutneighmax,cutghostuser);
 
   if (triclinic == 0) {
@@ -339,6 +358,11 @@ void CommBrick::setup()
   // pbc_flag: 0 = nothing across a boundary, 1 = something across a boundary
   // pbc = -1/0/1 for PBC factor in each of 3/6 orthogonal/triclinic dirs
   // for triclinic, slablo/hi and pbc_border will be used in lamda (0-1) coords
+  // triclinic entries 3/4/5 are the cached per-swap shear offsets:
+  //   pack routines turn them into dx/dy/dz via xprd/xy/xz etc once per swap,
+  //   so every-step forward comm does no per-atom lamda conversion
+  //   full x2lamda/lamda2x sweeps happen only around exchange/borders,
+  //   which is where triclinic overhead vs an orthogonal box actually lives
   // 1st part of if statement is sending to the west/south/down
   // 2nd part of if statement is sending to the east/north/up
 
@@ -455,6 +479,27 @@ int CommBrick::updown(int dim, int dir, int loc,
 /* ----------------------------------------------------------------------
    forward communication of atom coords every timestep
    other per-atom attributes may also be sent via pack/unpack routines
+   swaps in the same direction cannot be fused into one message:
+     when the ghost cutoff spans several sub-domains (maxneed > 1), each
+     swap forwards ghost atoms that only arrived in the previous swap,
+     since every proc exchanges with its nearest neighbors only, so the
+     store-and-forward chain is inherent to the brick protocol and its
+     latency grows with maxneed
+   comm_style tiled instead sends directly to every proc overlapping the
+     ghost extent, one message each, and is the appropriate choice when
+     the cutoff is a multiple of the sub-domain width
+   persistent MPI requests (MPI_Send_init/MPI_Recv_init posted once,
+     MPI_Start per step) were evaluated for these exchanges and not
+     adopted: the partners and tags are fixed after setup(), but the
+     message sizes are not, since sendnum/recvnum and the derived
+     size_forward_recv et al change at every reneighboring in borders(),
+     so the requests would have to be torn down and re-posted each
+     reneighboring, and exchange() messages are variable-sized every
+     call; LAMMPS must also keep building against the serial MPI stubs
+     in src/STUBS, which do not provide the persistent request API
+   mapping the brick onto the physical network is already available as
+     "processors * * * map cart/reorder", which passes reorder=1 to
+     MPI_Cart_create in ProcMap::cart_map
 ------------------------------------------------------------------------- */
 
 void CommBrick::forward_comm(int /*dummy*/)
@@ -477,9 +522,13 @@ void CommBrick::forward_comm(int /*dummy*/)
           MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
                     recvproc[iswap],0,world,&request);
         }
-        n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
-                            buf_send,pbc_flag[iswap],pbc[iswap]);
-        if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+        if (ddtype_flag && xddtype_set && xddtype_set[iswap]) {
+          MPI_Send(x[0],1,xddtype[iswap],sendproc[iswap],0,world);
+        } else {
+          n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                              buf_send,pbc_flag[iswap],pbc[iswap]);
+          if (n) MPI_Send(buf_send,n,MPI_DOUBLE,sendproc[iswap],0,world);
+        }
         if (size_forward_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
       } else if (ghost_velocity) {
         if (size_forward_recv[iswap])
@@ -580,6 +629,12 @@ void CommBrick::reverse_comm()
      or if atom moves more than one proc away
    this routine called before every reneighboring
    for triclinic, atoms must be in lamda coords (0-1) before exchange is called
+   per-atom pack/unpack through the AtomVec virtuals is intentional:
+     styles carry variable-length data (bonds, special lists, bonus data,
+     fix state), so datums have no fixed stride to bulk-copy, and the
+     backfill of departing atoms must interleave with the packing
+   message sizes are exchanged first, so receive buffers are presized
+     and each of the up-to-2 exchanges per dimension is a single message
 ------------------------------------------------------------------------- */
 
 void CommBrick::exchange()
@@ -874,6 +929,70 @@ void CommBrick::borders()
   // reset global->local map
 
   if (map_style) atom->map_set();
+
+  // rebuild derived datatypes for zero-copy forward comm of x
+
+  if (ddtype_flag && comm_x_only) build_ddtypes();
+}
+
+/* ----------------------------------------------------------------------
+   build an MPI indexed datatype over atom->x for each off-proc swap
+   lets forward_comm() send the listed coord triplets in place, skipping
+   the pack into buf_send entirely
+   only swaps with no PBC shift qualify, since shifted coords must be
+   packed with the offset applied
+   called at the end of borders(), whenever the send lists change
+------------------------------------------------------------------------- */
+
+void CommBrick::build_ddtypes()
+{
+  int i,iswap;
+
+  free_ddtypes();
+
+  if (nswap > maxddtype) {
+    memory->sfree(xddtype);
+    memory->destroy(xddtype_set);
+    maxddtype = nswap;
+    xddtype = (MPI_Datatype *)
+      memory->smalloc(maxddtype*sizeof(MPI_Datatype),"comm:xddtype");
+    memory->create(xddtype_set,maxddtype,"comm:xddtype_set");
+  }
+
+  int snmax = 0;
+  for (iswap = 0; iswap < nswap; iswap++) snmax = MAX(snmax,sendnum[iswap]);
+  int *displ;
+  memory->create(displ,snmax,"comm:ddtype:displ");
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+    xddtype_set[iswap] = 0;
+    if (sendproc[iswap] == me) continue;
+    if (pbc_flag[iswap]) continue;
+    if (sendnum[iswap] == 0) continue;
+
+    int *list = sendlist[iswap];
+    for (i = 0; i < sendnum[iswap]; i++) displ[i] = 3*list[i];
+    MPI_Type_create_indexed_block(sendnum[iswap],3,displ,MPI_DOUBLE,
+                                  &xddtype[iswap]);
+    MPI_Type_commit(&xddtype[iswap]);
+    xddtype_set[iswap] = 1;
+  }
+
+  memory->destroy(displ);
+}
+
+/* ----------------------------------------------------------------------
+   free any committed forward-comm datatypes
+------------------------------------------------------------------------- */
+
+void CommBrick::free_ddtypes()
+{
+  if (xddtype_set == NULL) return;
+  for (int iswap = 0; iswap < maxddtype; iswap++)
+    if (xddtype_set[iswap]) {
+      MPI_Type_free(&xddtype[iswap]);
+      xddtype_set[iswap] = 0;
+    }
 }
 
 /* ----------------------------------------------------------------------
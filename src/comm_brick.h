@@ -69,6 +69,10 @@ class CommBrick : public Comm {
   int **sendlist;                   // list of atoms to send in each swap
   int *maxsendlist;                 // max size of send list for each swap
 
+  MPI_Datatype *xddtype;            // derived datatype over x for each swap
+  int *xddtype_set;                 // 1 if xddtype[iswap] is built + committed
+  int maxddtype;                    // allocated length of xddtype arrays
+
   double *buf_send;                 // send buffer for all comm
   double *buf_recv;                 // recv buffer for all comm
   int maxsend,maxrecv;              // current size of send/recv buffer
@@ -80,6 +84,8 @@ class CommBrick : public Comm {
 
   int updown(int, int, int, double, int, double *);
                                             // compare cutoff to procs
+  void build_ddtypes();            // build derived datatypes for forward comm
+  void free_ddtypes();             // free committed derived datatypes
   virtual void grow_send(int, int);         // reallocate send buffer
   virtual void grow_recv(int);              // free/allocate recv buffer
   virtual void grow_list(int, int);         // reallocate one sendlist
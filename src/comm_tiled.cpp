@@ -119,6 +119,11 @@ void CommTiled::init()
 /* ----------------------------------------------------------------------
    setup spatial-decomposition communication patterns
    function of neighbor cutoff(s) & cutghostuser & current box size and tiling
+   box_drop overlap discovery happens only here, when the decomposition
+     or box changes - the per-swap proc lists and send boxes computed
+     here are the persistent plan reused by every timestep's exchanges
+   swaps are staged per dimension so lower-dim ghosts can be forwarded,
+     which is why the exchanges cannot collapse into a single collective
 ------------------------------------------------------------------------- */
 
 void CommTiled::setup()
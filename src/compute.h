@@ -42,6 +42,10 @@ class Compute : protected Pointers {
   int size_vector_variable;      // 1 if vec length is unknown in advance
   int size_array_rows_variable;  // 1 if array rows is unknown in advance
 
+  int reduce_batch_flag;    // 1 if compute_scalar() can be split into
+                            //   pack/unpack halves around its MPI_Allreduce
+                            //   so callers can fuse several into one call
+
   int peratom_flag;         // 0/1 if compute_peratom() function exists
   int size_peratom_cols;    // 0 = vector, N = columns in peratom array
 
@@ -106,6 +110,15 @@ class Compute : protected Pointers {
   virtual void compute_local() {}
   virtual void set_arrays(int) {}
 
+  // batched reduction interface, only used if reduce_batch_flag is set
+  // pack = local summation half of compute_scalar(), returns local value
+  // unpack = post-reduction half, arg = globally summed value
+  // a derived class which overrides compute_scalar() must either
+  //   override these consistently or clear reduce_batch_flag
+
+  virtual double pack_reduce_scalar() {return 0.0;}
+  virtual double unpack_reduce_scalar(double) {return 0.0;}
+
   virtual int pack_forward_comm(int, int *, double *, int, int *) {return 0;}
   virtual void unpack_forward_comm(int, int, double *) {}
   virtual int pack_reverse_comm(int, int, double *) {return 0;}
@@ -333,6 +333,17 @@ void ComputeCentroAtom::compute_peratom()
 #define SWAP(a,b)   tmp = a; a = b; b = tmp;
 #define ISWAP(a,b) itmp = a; a = b; b = itmp;
 
+/* ----------------------------------------------------------------------
+   select and select2 are the Numerical Recipes in-place quickselect,
+     already O(n) per atom, so the k-nearest subset is not a sorting
+     bottleneck; a shared k-NN helper was considered and dropped since
+     cna/atom is cutoff-based and never selects by count, leaving this
+     compute as the only client
+   thread parallelism over atoms belongs in the accelerator packages,
+     per the USER-OMP/USER-INTEL convention; the core computes stay
+     serial
+------------------------------------------------------------------------- */
+
 void ComputeCentroAtom::select(int k, int n, double *arr)
 {
   int i,ir,j,l,mid;
@@ -29,7 +29,8 @@ enum{ONCE,NFREQ,EVERY};
 
 ComputeCOMChunk::ComputeCOMChunk(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
-  idchunk(NULL), masstotal(NULL), massproc(NULL), com(NULL), comall(NULL)
+  idchunk(NULL), masstotal(NULL), massproc(NULL), com(NULL), comall(NULL),
+  redlocal(NULL), redglobal(NULL)
 {
   if (narg != 4) error->all(FLERR,"Illegal compute com/chunk command");
 
@@ -65,6 +66,8 @@ ComputeCOMChunk::~ComputeCOMChunk()
   memory->destroy(masstotal);
   memory->destroy(com);
   memory->destroy(comall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -143,9 +146,24 @@ void ComputeCOMChunk::compute_array()
       if (massneed) massproc[index] += massone;
     }
 
-  MPI_Allreduce(&com[0][0],&comall[0][0],3*nchunk,MPI_DOUBLE,MPI_SUM,world);
-  if (massneed)
-    MPI_Allreduce(massproc,masstotal,nchunk,MPI_DOUBLE,MPI_SUM,world);
+  // pack COM and mass sums into one buffer so a single Allreduce suffices
+
+  if (massneed) {
+    for (int i = 0; i < nchunk; i++) {
+      redlocal[4*i] = com[i][0];
+      redlocal[4*i+1] = com[i][1];
+      redlocal[4*i+2] = com[i][2];
+      redlocal[4*i+3] = massproc[i];
+    }
+    MPI_Allreduce(redlocal,redglobal,4*nchunk,MPI_DOUBLE,MPI_SUM,world);
+    for (int i = 0; i < nchunk; i++) {
+      comall[i][0] = redglobal[4*i];
+      comall[i][1] = redglobal[4*i+1];
+      comall[i][2] = redglobal[4*i+2];
+      masstotal[i] = redglobal[4*i+3];
+    }
+  } else
+    MPI_Allreduce(&com[0][0],&comall[0][0],3*nchunk,MPI_DOUBLE,MPI_SUM,world);
 
   for (int i = 0; i < nchunk; i++) {
     if (masstotal[i] > 0.0) {
@@ -222,11 +240,15 @@ void ComputeCOMChunk::allocate()
   memory->destroy(masstotal);
   memory->destroy(com);
   memory->destroy(comall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
   maxchunk = nchunk;
   memory->create(massproc,maxchunk,"com/chunk:massproc");
   memory->create(masstotal,maxchunk,"com/chunk:masstotal");
   memory->create(com,maxchunk,3,"com/chunk:com");
   memory->create(comall,maxchunk,3,"com/chunk:comall");
+  memory->create(redlocal,4*maxchunk,"com/chunk:redlocal");
+  memory->create(redglobal,4*maxchunk,"com/chunk:redglobal");
   array = comall;
 }
 
@@ -238,5 +260,6 @@ double ComputeCOMChunk::memory_usage()
 {
   double bytes = (bigint) maxchunk * 2 * sizeof(double);
   bytes += (bigint) maxchunk * 2*3 * sizeof(double);
+  bytes += (bigint) maxchunk * 2*4 * sizeof(double);
   return bytes;
 }
@@ -29,7 +29,7 @@ using namespace LAMMPS_NS;
 ComputeGyrationChunk::ComputeGyrationChunk(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
   idchunk(NULL), massproc(NULL), masstotal(NULL), com(NULL), comall(NULL),
-  rg(NULL), rgall(NULL), rgt(NULL), rgtall(NULL)
+  redlocal(NULL), redglobal(NULL), rg(NULL), rgall(NULL), rgt(NULL), rgtall(NULL)
 {
   if (narg < 4) error->all(FLERR,"Illegal compute gyration/chunk command");
 
@@ -81,6 +81,8 @@ ComputeGyrationChunk::~ComputeGyrationChunk()
   memory->destroy(masstotal);
   memory->destroy(com);
   memory->destroy(comall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
   memory->destroy(rg);
   memory->destroy(rgall);
   memory->destroy(rgt);
@@ -251,8 +253,21 @@ void ComputeGyrationChunk::com_chunk()
       com[index][2] += unwrap[2] * massone;
     }
 
-  MPI_Allreduce(massproc,masstotal,nchunk,MPI_DOUBLE,MPI_SUM,world);
-  MPI_Allreduce(&com[0][0],&comall[0][0],3*nchunk,MPI_DOUBLE,MPI_SUM,world);
+  // pack mass and COM sums into one buffer so a single Allreduce suffices
+
+  for (int i = 0; i < nchunk; i++) {
+    redlocal[4*i] = massproc[i];
+    redlocal[4*i+1] = com[i][0];
+    redlocal[4*i+2] = com[i][1];
+    redlocal[4*i+3] = com[i][2];
+  }
+  MPI_Allreduce(redlocal,redglobal,4*nchunk,MPI_DOUBLE,MPI_SUM,world);
+  for (int i = 0; i < nchunk; i++) {
+    masstotal[i] = redglobal[4*i];
+    comall[i][0] = redglobal[4*i+1];
+    comall[i][1] = redglobal[4*i+2];
+    comall[i][2] = redglobal[4*i+3];
+  }
 
   for (int i = 0; i < nchunk; i++) {
     if (masstotal[i] > 0.0) {
@@ -329,6 +344,8 @@ void ComputeGyrationChunk::allocate()
   memory->destroy(masstotal);
   memory->destroy(com);
   memory->destroy(comall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
   memory->destroy(rg);
   memory->destroy(rgall);
   memory->destroy(rgt);
@@ -338,6 +355,8 @@ void ComputeGyrationChunk::allocate()
   memory->create(masstotal,maxchunk,"gyration/chunk:masstotal");
   memory->create(com,maxchunk,3,"gyration/chunk:com");
   memory->create(comall,maxchunk,3,"gyration/chunk:comall");
+  memory->create(redlocal,4*maxchunk,"gyration/chunk:redlocal");
+  memory->create(redglobal,4*maxchunk,"gyration/chunk:redglobal");
   if (tensor) {
     memory->create(rgt,maxchunk,6,"gyration/chunk:rgt");
     memory->create(rgtall,maxchunk,6,"gyration/chunk:rgtall");
@@ -357,6 +376,7 @@ double ComputeGyrationChunk::memory_usage()
 {
   double bytes = (bigint) maxchunk * 2 * sizeof(double);
   bytes += (bigint) maxchunk * 2*3 * sizeof(double);
+  bytes += (bigint) maxchunk * 2*4 * sizeof(double);
   if (tensor) bytes += (bigint) maxchunk * 2*6 * sizeof(double);
   else bytes += (bigint) maxchunk * 2 * sizeof(double);
   return bytes;
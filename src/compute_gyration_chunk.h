@@ -49,6 +49,7 @@ class ComputeGyrationChunk : public Compute {
 
   double *massproc,*masstotal;
   double **com,**comall;
+  double *redlocal,*redglobal;
   double *rg,*rgall;
   double **rgt,**rgtall;
 
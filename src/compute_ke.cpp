@@ -30,6 +30,7 @@ ComputeKE::ComputeKE(LAMMPS *lmp, int narg, char **arg) :
   if (narg != 3) error->all(FLERR,"Illegal compute ke command");
 
   scalar_flag = 1;
+  reduce_batch_flag = 1;
   extscalar = 1;
 }
 
@@ -44,8 +45,18 @@ void ComputeKE::init()
 
 double ComputeKE::compute_scalar()
 {
-  invoked_scalar = update->ntimestep;
+  double ke = pack_reduce_scalar();
+  double keall;
+  MPI_Allreduce(&ke,&keall,1,MPI_DOUBLE,MPI_SUM,world);
+  return unpack_reduce_scalar(keall);
+}
 
+/* ----------------------------------------------------------------------
+   local summation half of compute_scalar(), no MPI calls
+------------------------------------------------------------------------- */
+
+double ComputeKE::pack_reduce_scalar()
+{
   double **v = atom->v;
   double *rmass = atom->rmass;
   double *mass = atom->mass;
@@ -66,7 +77,18 @@ double ComputeKE::compute_scalar()
           (v[i][0]*v[i][0] + v[i][1]*v[i][1] + v[i][2]*v[i][2]);
   }
 
-  MPI_Allreduce(&ke,&scalar,1,MPI_DOUBLE,MPI_SUM,world);
+  return ke;
+}
+
+/* ----------------------------------------------------------------------
+   post-reduction half of compute_scalar(), sum = globally summed KE
+------------------------------------------------------------------------- */
+
+double ComputeKE::unpack_reduce_scalar(double sum)
+{
+  invoked_scalar = update->ntimestep;
+
+  scalar = sum;
   scalar *= pfactor;
   return scalar;
 }
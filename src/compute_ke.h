@@ -29,6 +29,8 @@ class ComputeKE : public Compute {
   ComputeKE(class LAMMPS *, int, char **);
   void init();
   double compute_scalar();
+  double pack_reduce_scalar();
+  double unpack_reduce_scalar(double);
 
  private:
   double pfactor;
@@ -29,7 +29,8 @@ using namespace LAMMPS_NS;
 
 ComputeMSDChunk::ComputeMSDChunk(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
-  idchunk(NULL), id_fix(NULL), massproc(NULL), masstotal(NULL), com(NULL), comall(NULL), msd(NULL)
+  idchunk(NULL), id_fix(NULL), massproc(NULL), masstotal(NULL), com(NULL), comall(NULL),
+  redlocal(NULL), redglobal(NULL), msd(NULL)
 {
   if (narg != 4) error->all(FLERR,"Illegal compute msd/chunk command");
 
@@ -86,6 +87,8 @@ ComputeMSDChunk::~ComputeMSDChunk()
   memory->destroy(masstotal);
   memory->destroy(com);
   memory->destroy(comall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
   memory->destroy(msd);
 }
 
@@ -194,8 +197,21 @@ void ComputeMSDChunk::compute_array()
       com[index][2] += unwrap[2] * massone;
     }
 
-  MPI_Allreduce(massproc,masstotal,nchunk,MPI_DOUBLE,MPI_SUM,world);
-  MPI_Allreduce(&com[0][0],&comall[0][0],3*nchunk,MPI_DOUBLE,MPI_SUM,world);
+  // pack mass and COM sums into one buffer so a single Allreduce suffices
+
+  for (int i = 0; i < nchunk; i++) {
+    redlocal[4*i] = massproc[i];
+    redlocal[4*i+1] = com[i][0];
+    redlocal[4*i+2] = com[i][1];
+    redlocal[4*i+3] = com[i][2];
+  }
+  MPI_Allreduce(redlocal,redglobal,4*nchunk,MPI_DOUBLE,MPI_SUM,world);
+  for (int i = 0; i < nchunk; i++) {
+    masstotal[i] = redglobal[4*i];
+    comall[i][0] = redglobal[4*i+1];
+    comall[i][1] = redglobal[4*i+2];
+    comall[i][2] = redglobal[4*i+3];
+  }
 
   for (int i = 0; i < nchunk; i++) {
     if (masstotal[i] > 0.0) {
@@ -290,6 +306,8 @@ void ComputeMSDChunk::allocate()
   memory->create(masstotal,nchunk,"msd/chunk:masstotal");
   memory->create(com,nchunk,3,"msd/chunk:com");
   memory->create(comall,nchunk,3,"msd/chunk:comall");
+  memory->create(redlocal,4*nchunk,"msd/chunk:redlocal");
+  memory->create(redglobal,4*nchunk,"msd/chunk:redglobal");
   memory->create(msd,nchunk,4,"msd/chunk:msd");
   array = msd;
 }
@@ -302,6 +320,7 @@ double ComputeMSDChunk::memory_usage()
 {
   double bytes = (bigint) nchunk * 2 * sizeof(double);
   bytes += (bigint) nchunk * 2*3 * sizeof(double);
+  bytes += (bigint) nchunk * 2*4 * sizeof(double);
   bytes += (bigint) nchunk * 4 * sizeof(double);
   return bytes;
 }
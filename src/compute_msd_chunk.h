@@ -50,6 +50,7 @@ class ComputeMSDChunk : public Compute {
 
   double *massproc,*masstotal;
   double **com,**comall;
+  double *redlocal,*redglobal;
   double **msd;
 
   void allocate();
@@ -48,7 +48,7 @@ using namespace std;
 ComputeOrientOrderAtom::ComputeOrientOrderAtom(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
   qlist(NULL), distsq(NULL), nearest(NULL), rlist(NULL),
-  qnarray(NULL), qnm_r(NULL), qnm_i(NULL)
+  qnarray(NULL), qnm_r(NULL), qnm_i(NULL), ylmnorm(NULL)
 {
   if (narg < 3 ) error->all(FLERR,"Illegal compute orientorder/atom command");
 
@@ -151,6 +151,7 @@ ComputeOrientOrderAtom::~ComputeOrientOrderAtom()
   memory->destroy(qlist);
   memory->destroy(qnm_r);
   memory->destroy(qnm_i);
+  memory->destroy(ylmnorm);
 
 }
 
@@ -169,6 +170,20 @@ void ComputeOrientOrderAtom::init()
   memory->create(qnm_r,qmax,2*qmax+1,"orientorder/atom:qnm_r");
   memory->create(qnm_i,qmax,2*qmax+1,"orientorder/atom:qnm_i");
 
+  // precompute Ylm normalization factors, which depend only on (l,m):
+  // Y_l^m (theta, phi) = ylmnorm * P_l^m (cos(theta)) * exp(i*m*phi)
+
+  memory->create(ylmnorm,nqlist,qmax+1,"orientorder/atom:ylmnorm");
+  for (int iw = 0; iw < nqlist; iw++) {
+    int n = qlist[iw];
+    for (int m = 0; m <= n; m++) {
+      double prod = 1.0;
+      for (int i = n-m+1; i < n+m+1; ++i)
+        prod *= static_cast<double>(i);
+      ylmnorm[iw][m] = sqrt(static_cast<double>(2*n+1)/(MY_4PI*prod));
+    }
+  }
+
   // need an occasional full neighbor list
 
   int irequest = neighbor->request(this,instance_me);
@@ -436,11 +451,11 @@ void ComputeOrientOrderAtom::calc_boop(double **rlist,
     for (int iw = 0; iw < nqlist; iw++) {
       int n = qlist[iw];
 
-      qnm_r[iw][n] += polar_prefactor(n, 0, costheta);
+      qnm_r[iw][n] += ylmnorm[iw][0]*associated_legendre(n,0,costheta);
       double expphim_r = expphi_r;
       double expphim_i = expphi_i;
       for(int m = 1; m <= +n; m++) {
-        double prefactor = polar_prefactor(n, m, costheta);
+        double prefactor = ylmnorm[iw][m]*associated_legendre(n,m,costheta);
         double c_r = prefactor * expphim_r;
         double c_i = prefactor * expphim_i;
         qnm_r[iw][m+n] += c_r;
@@ -496,27 +511,6 @@ double ComputeOrientOrderAtom::dist(const double r[])
   return sqrt(r[0]*r[0] + r[1]*r[1] + r[2]*r[2]);
 }
 
-/* ----------------------------------------------------------------------
-   polar prefactor for spherical harmonic Y_l^m, where
-   Y_l^m (theta, phi) = prefactor(l, m, cos(theta)) * exp(i*m*phi)
-------------------------------------------------------------------------- */
-
-double ComputeOrientOrderAtom::polar_prefactor(int l, int m, double costheta)
-{
-  const int mabs = abs(m);
-
-  double prefactor = 1.0;
-  for (int i=l-mabs+1; i < l+mabs+1; ++i)
-    prefactor *= static_cast<double>(i);
-
-  prefactor = sqrt(static_cast<double>(2*l+1)/(MY_4PI*prefactor))
-    * associated_legendre(l,mabs,costheta);
-
-  if ((m < 0) && (m % 2)) prefactor = -prefactor;
-
-  return prefactor;
-}
-
 /* ----------------------------------------------------------------------
    associated legendre polynomial
 ------------------------------------------------------------------------- */
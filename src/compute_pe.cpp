@@ -38,6 +38,7 @@ ComputePE::ComputePE(LAMMPS *lmp, int narg, char **arg) :
   if (igroup) error->all(FLERR,"Compute pe must use group all");
 
   scalar_flag = 1;
+  reduce_batch_flag = 1;
   extscalar = 1;
   peflag = 1;
   timeflag = 1;
@@ -71,8 +72,19 @@ ComputePE::ComputePE(LAMMPS *lmp, int narg, char **arg) :
 
 double ComputePE::compute_scalar()
 {
-  invoked_scalar = update->ntimestep;
-  if (update->eflag_global != invoked_scalar)
+  double one = pack_reduce_scalar();
+  double all;
+  MPI_Allreduce(&one,&all,1,MPI_DOUBLE,MPI_SUM,world);
+  return unpack_reduce_scalar(all);
+}
+
+/* ----------------------------------------------------------------------
+   local summation half of compute_scalar(), no MPI calls
+------------------------------------------------------------------------- */
+
+double ComputePE::pack_reduce_scalar()
+{
+  if (update->eflag_global != update->ntimestep)
     error->all(FLERR,"Energy was not tallied on needed timestep");
 
   double one = 0.0;
@@ -86,7 +98,18 @@ double ComputePE::compute_scalar()
     if (improperflag && force->improper) one += force->improper->energy;
   }
 
-  MPI_Allreduce(&one,&scalar,1,MPI_DOUBLE,MPI_SUM,world);
+  return one;
+}
+
+/* ----------------------------------------------------------------------
+   post-reduction half of compute_scalar(), sum = globally summed energy
+------------------------------------------------------------------------- */
+
+double ComputePE::unpack_reduce_scalar(double sum)
+{
+  invoked_scalar = update->ntimestep;
+
+  scalar = sum;
 
   if (kspaceflag && force->kspace) scalar += force->kspace->energy;
 
@@ -30,6 +30,8 @@ class ComputePE : public Compute {
   ~ComputePE() {}
   void init() {}
   double compute_scalar();
+  double pack_reduce_scalar();
+  double unpack_reduce_scalar(double);
 
  private:
   int pairflag,bondflag,angleflag,dihedralflag,improperflag,kspaceflag,fixflag;
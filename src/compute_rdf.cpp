@@ -265,7 +265,7 @@ void ComputeRDF::init_norm()
 void ComputeRDF::compute_array()
 {
   int i,j,m,ii,jj,inum,jnum,itype,jtype,ipair,jpair,ibin,ihisto;
-  double xtmp,ytmp,ztmp,delx,dely,delz,r;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq,r;
   int *ilist,*jlist,*numneigh,**firstneigh;
   double factor_lj,factor_coul;
 
@@ -312,6 +312,13 @@ void ComputeRDF::compute_array()
   double *special_lj = force->special_lj;
   int newton_pair = force->newton_pair;
 
+  // pairs in the skin shell of the list fall beyond the last bin:
+  // reject them on the squared distance before taking the sqrt
+  // one bin of margin so the exact ibin test below stays authoritative
+
+  double rhist = (nbin+1)*delr;
+  double cutsq_hist = rhist*rhist;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     if (!(mask[i] & groupbit)) continue;
@@ -343,7 +350,9 @@ void ComputeRDF::compute_array()
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
       delz = ztmp - x[j][2];
-      r = sqrt(delx*delx + dely*dely + delz*delz);
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq > cutsq_hist) continue;
+      r = sqrt(rsq);
       ibin = static_cast<int> (r*delrinv);
       if (ibin >= nbin) continue;
 
@@ -46,7 +46,7 @@ ComputeReduce::ComputeReduce(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
   nvalues(0), which(NULL), argindex(NULL), flavor(NULL),
   value2index(NULL), ids(NULL), onevec(NULL), replace(NULL), indices(NULL),
-  owner(NULL), idregion(NULL), varatom(NULL)
+  owner(NULL), idregion(NULL), varatom(NULL), pairme(NULL), pairall(NULL)
 {
   int iarg = 0;
   if (strcmp(style,"reduce") == 0) {
@@ -283,6 +283,7 @@ ComputeReduce::ComputeReduce(LAMMPS *lmp, int narg, char **arg) :
     else extscalar = 0;
     vector = onevec = NULL;
     indices = owner = NULL;
+    pairme = pairall = NULL;
   } else {
     vector_flag = 1;
     size_vector = nvalues;
@@ -292,6 +293,8 @@ ComputeReduce::ComputeReduce(LAMMPS *lmp, int narg, char **arg) :
     onevec = new double[size_vector];
     indices = new int[size_vector];
     owner = new int[size_vector];
+    pairme = new Pair[size_vector];
+    pairall = new Pair[size_vector];
   }
 
   maxatom = 0;
@@ -315,6 +318,8 @@ ComputeReduce::~ComputeReduce()
   delete [] onevec;
   delete [] indices;
   delete [] owner;
+  delete [] pairme;
+  delete [] pairall;
 
   memory->destroy(varatom);
 }
@@ -391,23 +396,27 @@ void ComputeReduce::compute_vector()
       indices[m] = index;
     }
 
+  // reduce all values in a single call, not one call per value
+  // for replaced values the entries in the reduction are ignored
+
   if (mode == SUM || mode == SUMSQ) {
-    for (int m = 0; m < nvalues; m++)
-      MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_SUM,world);
+    MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_SUM,world);
 
   } else if (mode == MINN) {
     if (!replace) {
-      for (int m = 0; m < nvalues; m++)
-        MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_MIN,world);
+      MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_MIN,world);
 
     } else {
+      for (int m = 0; m < nvalues; m++) {
+        if (replace[m] < 0) pairme[m].value = onevec[m];
+        else pairme[m].value = 0.0;
+        pairme[m].proc = me;
+      }
+      MPI_Allreduce(pairme,pairall,nvalues,MPI_DOUBLE_INT,MPI_MINLOC,world);
       for (int m = 0; m < nvalues; m++)
         if (replace[m] < 0) {
-          pairme.value = onevec[m];
-          pairme.proc = me;
-          MPI_Allreduce(&pairme,&pairall,1,MPI_DOUBLE_INT,MPI_MINLOC,world);
-          vector[m] = pairall.value;
-          owner[m] = pairall.proc;
+          vector[m] = pairall[m].value;
+          owner[m] = pairall[m].proc;
         }
       for (int m = 0; m < nvalues; m++)
         if (replace[m] >= 0) {
@@ -419,17 +428,19 @@ void ComputeReduce::compute_vector()
 
   } else if (mode == MAXX) {
     if (!replace) {
-      for (int m = 0; m < nvalues; m++)
-        MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_MAX,world);
+      MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_MAX,world);
 
     } else {
+      for (int m = 0; m < nvalues; m++) {
+        if (replace[m] < 0) pairme[m].value = onevec[m];
+        else pairme[m].value = 0.0;
+        pairme[m].proc = me;
+      }
+      MPI_Allreduce(pairme,pairall,nvalues,MPI_DOUBLE_INT,MPI_MAXLOC,world);
       for (int m = 0; m < nvalues; m++)
         if (replace[m] < 0) {
-          pairme.value = onevec[m];
-          pairme.proc = me;
-          MPI_Allreduce(&pairme,&pairall,1,MPI_DOUBLE_INT,MPI_MAXLOC,world);
-          vector[m] = pairall.value;
-          owner[m] = pairall.proc;
+          vector[m] = pairall[m].value;
+          owner[m] = pairall[m].proc;
         }
       for (int m = 0; m < nvalues; m++)
         if (replace[m] >= 0) {
@@ -440,8 +451,8 @@ void ComputeReduce::compute_vector()
     }
 
   } else if (mode == AVE || mode == AVESQ) {
+    MPI_Allreduce(onevec,vector,nvalues,MPI_DOUBLE,MPI_SUM,world);
     for (int m = 0; m < nvalues; m++) {
-      MPI_Allreduce(&onevec[m],&vector[m],1,MPI_DOUBLE,MPI_SUM,world);
       bigint n = count(m);
       if (n) vector[m] /= n;
     }
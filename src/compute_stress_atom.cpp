@@ -164,53 +164,46 @@ void ComputeStressAtom::compute_peratom()
   if (force->kspace && force->kspace->tip4pflag) nkspace += atom->nghost;
 
   // clear local stress array
+  // stress and all vatom arrays are contiguous 2d arrays,
+  //   so accumulate them as flat vectors of 6*N values
+  // stress is still NULL on a proc that has never allocated per-atom
+  //   arrays (nmax = 0), every count used below is then also zero
 
-  for (i = 0; i < ntotal; i++)
-    for (j = 0; j < 6; j++)
-      stress[i][j] = 0.0;
+  double *sv = NULL;
+  if (stress) sv = &stress[0][0];
+
+  for (i = 0; i < 6*ntotal; i++) sv[i] = 0.0;
 
   // add in per-atom contributions from each force
 
-  if (pairflag && force->pair) {
-    double **vatom = force->pair->vatom;
-    for (i = 0; i < npair; i++)
-      for (j = 0; j < 6; j++)
-        stress[i][j] += vatom[i][j];
+  if (pairflag && force->pair && npair) {
+    double *vatom = &force->pair->vatom[0][0];
+    for (i = 0; i < 6*npair; i++) sv[i] += vatom[i];
   }
 
-  if (bondflag && force->bond) {
-    double **vatom = force->bond->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++)
-        stress[i][j] += vatom[i][j];
+  if (bondflag && force->bond && nbond) {
+    double *vatom = &force->bond->vatom[0][0];
+    for (i = 0; i < 6*nbond; i++) sv[i] += vatom[i];
   }
 
-  if (angleflag && force->angle) {
-    double **vatom = force->angle->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++)
-        stress[i][j] += vatom[i][j];
+  if (angleflag && force->angle && nbond) {
+    double *vatom = &force->angle->vatom[0][0];
+    for (i = 0; i < 6*nbond; i++) sv[i] += vatom[i];
   }
 
-  if (dihedralflag && force->dihedral) {
-    double **vatom = force->dihedral->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++)
-        stress[i][j] += vatom[i][j];
+  if (dihedralflag && force->dihedral && nbond) {
+    double *vatom = &force->dihedral->vatom[0][0];
+    for (i = 0; i < 6*nbond; i++) sv[i] += vatom[i];
   }
 
-  if (improperflag && force->improper) {
-    double **vatom = force->improper->vatom;
-    for (i = 0; i < nbond; i++)
-      for (j = 0; j < 6; j++)
-        stress[i][j] += vatom[i][j];
+  if (improperflag && force->improper && nbond) {
+    double *vatom = &force->improper->vatom[0][0];
+    for (i = 0; i < 6*nbond; i++) sv[i] += vatom[i];
   }
 
-  if (kspaceflag && force->kspace) {
-    double **vatom = force->kspace->vatom;
-    for (i = 0; i < nkspace; i++)
-      for (j = 0; j < 6; j++)
-        stress[i][j] += vatom[i][j];
+  if (kspaceflag && force->kspace && nkspace) {
+    double *vatom = &force->kspace->vatom[0][0];
+    for (i = 0; i < 6*nkspace; i++) sv[i] += vatom[i];
   }
 
   // add in per-atom contributions from relevant fixes
@@ -32,6 +32,7 @@ ComputeTemp::ComputeTemp(LAMMPS *lmp, int narg, char **arg) :
   if (narg != 3) error->all(FLERR,"Illegal compute temp command");
 
   scalar_flag = vector_flag = 1;
+  reduce_batch_flag = 1;
   size_vector = 6;
   extscalar = 0;
   extvector = 1;
@@ -73,8 +74,18 @@ void ComputeTemp::dof_compute()
 
 double ComputeTemp::compute_scalar()
 {
-  invoked_scalar = update->ntimestep;
+  double t = pack_reduce_scalar();
+  double tall;
+  MPI_Allreduce(&t,&tall,1,MPI_DOUBLE,MPI_SUM,world);
+  return unpack_reduce_scalar(tall);
+}
 
+/* ----------------------------------------------------------------------
+   local summation half of compute_scalar(), no MPI calls
+------------------------------------------------------------------------- */
+
+double ComputeTemp::pack_reduce_scalar()
+{
   double **v = atom->v;
   double *mass = atom->mass;
   double *rmass = atom->rmass;
@@ -95,7 +106,18 @@ double ComputeTemp::compute_scalar()
           mass[type[i]];
   }
 
-  MPI_Allreduce(&t,&scalar,1,MPI_DOUBLE,MPI_SUM,world);
+  return t;
+}
+
+/* ----------------------------------------------------------------------
+   post-reduction half of compute_scalar(), sum = globally summed KE
+------------------------------------------------------------------------- */
+
+double ComputeTemp::unpack_reduce_scalar(double sum)
+{
+  invoked_scalar = update->ntimestep;
+
+  scalar = sum;
   if (dynamic) dof_compute();
   if (dof < 0.0 && natoms_temp > 0.0)
     error->all(FLERR,"Temperature compute degrees of freedom < 0");
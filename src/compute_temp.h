@@ -32,6 +32,8 @@ class ComputeTemp : public Compute {
   void setup();
   virtual double compute_scalar();
   virtual void compute_vector();
+  double pack_reduce_scalar();
+  double unpack_reduce_scalar(double);
 
  protected:
   double tfactor;
@@ -31,7 +31,8 @@ enum{TEMP,KECOM,INTERNAL};
 ComputeTempChunk::ComputeTempChunk(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
   which(NULL), idchunk(NULL), id_bias(NULL), sum(NULL), sumall(NULL), count(NULL),
-  countall(NULL), massproc(NULL), masstotal(NULL), vcm(NULL), vcmall(NULL)
+  countall(NULL), massproc(NULL), masstotal(NULL), vcm(NULL), vcmall(NULL),
+  redlocal(NULL), redglobal(NULL)
 {
   if (narg < 4) error->all(FLERR,"Illegal compute temp/chunk command");
 
@@ -161,6 +162,8 @@ ComputeTempChunk::~ComputeTempChunk()
   memory->destroy(masstotal);
   memory->destroy(vcm);
   memory->destroy(vcmall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -465,8 +468,21 @@ void ComputeTempChunk::vcm_compute()
       massproc[index] += massone;
     }
 
-  MPI_Allreduce(&vcm[0][0],&vcmall[0][0],3*nchunk,MPI_DOUBLE,MPI_SUM,world);
-  MPI_Allreduce(massproc,masstotal,nchunk,MPI_DOUBLE,MPI_SUM,world);
+  // pack VCM and mass sums into one buffer so a single Allreduce suffices
+
+  for (i = 0; i < nchunk; i++) {
+    redlocal[4*i] = vcm[i][0];
+    redlocal[4*i+1] = vcm[i][1];
+    redlocal[4*i+2] = vcm[i][2];
+    redlocal[4*i+3] = massproc[i];
+  }
+  MPI_Allreduce(redlocal,redglobal,4*nchunk,MPI_DOUBLE,MPI_SUM,world);
+  for (i = 0; i < nchunk; i++) {
+    vcmall[i][0] = redglobal[4*i];
+    vcmall[i][1] = redglobal[4*i+1];
+    vcmall[i][2] = redglobal[4*i+2];
+    masstotal[i] = redglobal[4*i+3];
+  }
 
   for (i = 0; i < nchunk; i++) {
     if (masstotal[i] > 0.0) {
@@ -837,10 +853,14 @@ void ComputeTempChunk::allocate()
     memory->destroy(masstotal);
     memory->destroy(vcm);
     memory->destroy(vcmall);
+    memory->destroy(redlocal);
+    memory->destroy(redglobal);
     memory->create(massproc,maxchunk,"vcm/chunk:massproc");
     memory->create(masstotal,maxchunk,"vcm/chunk:masstotal");
     memory->create(vcm,maxchunk,3,"vcm/chunk:vcm");
     memory->create(vcmall,maxchunk,3,"vcm/chunk:vcmall");
+    memory->create(redlocal,4*maxchunk,"vcm/chunk:redlocal");
+    memory->create(redglobal,4*maxchunk,"vcm/chunk:redglobal");
   }
 }
 
@@ -856,6 +876,7 @@ double ComputeTempChunk::memory_usage()
   if (comflag || nvalues) {
     bytes += (bigint) maxchunk * 2 * sizeof(double);
     bytes += (bigint) maxchunk * 2*3 * sizeof(double);
+    bytes += (bigint) maxchunk * 2*4 * sizeof(double);
   }
   return bytes;
 }
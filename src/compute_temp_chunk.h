@@ -61,6 +61,7 @@ class ComputeTempChunk : public Compute {
   int *count,*countall;
   double *massproc,*masstotal;
   double **vcm,**vcmall;
+  double *redlocal,*redglobal;
 
   void vcm_compute();
   void temperature(int);
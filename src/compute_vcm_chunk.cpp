@@ -29,7 +29,8 @@ enum{ONCE,NFREQ,EVERY};
 
 ComputeVCMChunk::ComputeVCMChunk(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
-  idchunk(NULL), massproc(NULL), masstotal(NULL), vcm(NULL), vcmall(NULL)
+  idchunk(NULL), massproc(NULL), masstotal(NULL), vcm(NULL), vcmall(NULL),
+  redlocal(NULL), redglobal(NULL)
 {
   if (narg != 4) error->all(FLERR,"Illegal compute vcm/chunk command");
 
@@ -65,6 +66,8 @@ ComputeVCMChunk::~ComputeVCMChunk()
   memory->destroy(masstotal);
   memory->destroy(vcm);
   memory->destroy(vcmall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -140,9 +143,24 @@ void ComputeVCMChunk::compute_array()
       if (massneed) massproc[index] += massone;
     }
 
-  MPI_Allreduce(&vcm[0][0],&vcmall[0][0],3*nchunk,MPI_DOUBLE,MPI_SUM,world);
-  if (massneed)
-    MPI_Allreduce(massproc,masstotal,nchunk,MPI_DOUBLE,MPI_SUM,world);
+  // pack VCM and mass sums into one buffer so a single Allreduce suffices
+
+  if (massneed) {
+    for (int i = 0; i < nchunk; i++) {
+      redlocal[4*i] = vcm[i][0];
+      redlocal[4*i+1] = vcm[i][1];
+      redlocal[4*i+2] = vcm[i][2];
+      redlocal[4*i+3] = massproc[i];
+    }
+    MPI_Allreduce(redlocal,redglobal,4*nchunk,MPI_DOUBLE,MPI_SUM,world);
+    for (int i = 0; i < nchunk; i++) {
+      vcmall[i][0] = redglobal[4*i];
+      vcmall[i][1] = redglobal[4*i+1];
+      vcmall[i][2] = redglobal[4*i+2];
+      masstotal[i] = redglobal[4*i+3];
+    }
+  } else
+    MPI_Allreduce(&vcm[0][0],&vcmall[0][0],3*nchunk,MPI_DOUBLE,MPI_SUM,world);
 
   for (int i = 0; i < nchunk; i++) {
     if (masstotal[i] > 0.0) {
@@ -219,11 +237,15 @@ void ComputeVCMChunk::allocate()
   memory->destroy(masstotal);
   memory->destroy(vcm);
   memory->destroy(vcmall);
+  memory->destroy(redlocal);
+  memory->destroy(redglobal);
   maxchunk = nchunk;
   memory->create(massproc,maxchunk,"vcm/chunk:massproc");
   memory->create(masstotal,maxchunk,"vcm/chunk:masstotal");
   memory->create(vcm,maxchunk,3,"vcm/chunk:vcm");
   memory->create(vcmall,maxchunk,3,"vcm/chunk:vcmall");
+  memory->create(redlocal,4*maxchunk,"vcm/chunk:redlocal");
+  memory->create(redglobal,4*maxchunk,"vcm/chunk:redglobal");
   array = vcmall;
 }
 
@@ -235,5 +257,6 @@ double ComputeVCMChunk::memory_usage()
 {
   double bytes = (bigint) maxchunk * 2 * sizeof(double);
   bytes += (bigint) maxchunk * 2*3 * sizeof(double);
+  bytes += (bigint) maxchunk * 2*4 * sizeof(double);
   return bytes;
 }
@@ -48,6 +48,7 @@ class ComputeVCMChunk : public Compute {
 
   double *massproc,*masstotal;
   double **vcm,**vcmall;
+  double *redlocal,*redglobal;
 
   void allocate();
 };
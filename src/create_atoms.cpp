@@ -736,6 +736,32 @@ void CreateAtoms::add_lattice()
   if (ymin < 0.0) jlo--;
   if (zmin < 0.0) klo--;
 
+  // delta = change in box (or lamda) coords of a site when i increments by 1
+  // site coords are affine in i, so each row of the innermost loop can be
+  //   clipped to a candidate index interval before any per-site tests
+  // for triclinic boxes and rotated lattice orientations the bounding box
+  //   above greatly overestimates the subbox overlap, and without the
+  //   clipping nearly every site in those rows fails the subbox test
+
+  double delta[3],pone[3],ptwo[3],lone[3],ltwo[3];
+
+  pone[0] = pone[1] = pone[2] = 0.0;
+  ptwo[0] = 1.0; ptwo[1] = ptwo[2] = 0.0;
+  domain->lattice->lattice2box(pone[0],pone[1],pone[2]);
+  domain->lattice->lattice2box(ptwo[0],ptwo[1],ptwo[2]);
+
+  if (triclinic) {
+    domain->x2lamda(pone,lone);
+    domain->x2lamda(ptwo,ltwo);
+    delta[0] = ltwo[0] - lone[0];
+    delta[1] = ltwo[1] - lone[1];
+    delta[2] = ltwo[2] - lone[2];
+  } else {
+    delta[0] = ptwo[0] - pone[0];
+    delta[1] = ptwo[1] - pone[1];
+    delta[2] = ptwo[2] - pone[2];
+  }
+
   // iterate on 3d periodic lattice of unit cells using loop bounds
   // iterate on nbasis atoms in each unit cell
   // convert lattice coords to box coords
@@ -745,10 +771,54 @@ void CreateAtoms::add_lattice()
   double x[3],lamda[3];
   double *coord;
 
-  int i,j,k,m;
+  int i,j,k,m,d,isrow,ierow;
+  double dlo,dhi,r1,r2;
+
   for (k = klo; k <= khi; k++)
-    for (j = jlo; j <= jhi; j++)
-      for (i = ilo; i <= ihi; i++)
+    for (j = jlo; j <= jhi; j++) {
+
+      // clip the i loop to the union over the basis of the index intervals
+      //   whose coords can pass the subbox test below
+      // intervals are padded by one cell so round-off cannot clip a site
+      //   the exact per-site test would accept, results are thus identical
+
+      isrow = ihi + 1;
+      ierow = ilo - 1;
+
+      for (m = 0; m < nbasis; m++) {
+        x[0] = basis[m][0];
+        x[1] = j + basis[m][1];
+        x[2] = k + basis[m][2];
+        domain->lattice->lattice2box(x[0],x[1],x[2]);
+
+        if (triclinic) {
+          domain->x2lamda(x,lamda);
+          coord = lamda;
+        } else coord = x;
+
+        dlo = (double) ilo;
+        dhi = (double) ihi;
+        for (d = 0; d < 3; d++) {
+          if (delta[d] == 0.0) continue;
+          r1 = (sublo[d] - coord[d]) / delta[d];
+          r2 = (subhi[d] - coord[d]) / delta[d];
+          if (delta[d] > 0.0) {
+            dlo = MAX(dlo,r1);
+            dhi = MIN(dhi,r2);
+          } else {
+            dlo = MAX(dlo,r2);
+            dhi = MIN(dhi,r1);
+          }
+        }
+
+        if (dlo > (double) ihi + 1.0 || dhi < (double) ilo - 1.0) continue;
+        dlo = MAX(dlo,(double) ilo);
+        dhi = MIN(dhi,(double) ihi);
+        isrow = MIN(isrow,MAX(static_cast<int> (floor(dlo)) - 1,ilo));
+        ierow = MAX(ierow,MIN(static_cast<int> (ceil(dhi)) + 1,ihi));
+      }
+
+      for (i = isrow; i <= ierow; i++)
         for (m = 0; m < nbasis; m++) {
 
           x[0] = i + basis[m][0];
@@ -759,16 +829,9 @@ void CreateAtoms::add_lattice()
 
           domain->lattice->lattice2box(x[0],x[1],x[2]);
 
-          // if a region was specified, test if atom is in it
-
-          if (style == REGION)
-            if (!domain->regions[nregion]->match(x[0],x[1],x[2])) continue;
-
-          // if variable test specified, eval variable
-
-          if (varflag && vartest(x) == 0) continue;
-
           // test if atom/molecule position is in my subbox
+          // done before the region/variable tests since it is much
+          //   cheaper and rejects sites only in my lattice bbox overlap
 
           if (triclinic) {
             domain->x2lamda(x,lamda);
@@ -779,11 +842,21 @@ void CreateAtoms::add_lattice()
               coord[1] < sublo[1] || coord[1] >= subhi[1] ||
               coord[2] < sublo[2] || coord[2] >= subhi[2]) continue;
 
+          // if a region was specified, test if atom is in it
+
+          if (style == REGION)
+            if (!domain->regions[nregion]->match(x[0],x[1],x[2])) continue;
+
+          // if variable test specified, eval variable
+
+          if (varflag && vartest(x) == 0) continue;
+
           // add the atom or entire molecule to my list of atoms
 
           if (mode == ATOM) atom->avec->create_atom(basistype[m],x);
           else add_molecule(x);
         }
+    }
 }
 
 /* ----------------------------------------------------------------------
@@ -89,6 +89,15 @@ void DeleteAtoms::command(int narg, char **arg)
 
     // delete local atoms flagged in dlist
     // reset nlocal
+    // the swap-with-last loop performs at most one avec->copy() per
+    //   deleted atom, which is fewer moves than a stable partition of
+    //   the per-atom arrays (order does not matter, the map is rebuilt
+    //   below)
+    // the map/topology rebuild cannot be deferred across invocations,
+    //   later commands in the script rely on a consistent map, so
+    //   scripts issuing many delete_atoms calls should merge their
+    //   criteria into one call (union regions, or one group) to pay
+    //   for the rebuild once
 
     AtomVec *avec = atom->avec;
     int nlocal = atom->nlocal;
@@ -530,9 +530,14 @@ void Domain::pbc()
   }
 
   // apply PBC to each owned atom
+  // periodicity tests are per-dimension, not per-atom, so each
+  //   dimension gets its own loop and a non-periodic dimension skips
+  //   its pass entirely
+  // per-atom updates in each dimension only depend on that dimension's
+  //   coord, so splitting the loop does not change the results
 
-  for (i = 0; i < nlocal; i++) {
-    if (xperiodic) {
+  if (xperiodic) {
+    for (i = 0; i < nlocal; i++) {
       if (x[i][0] < lo[0]) {
         x[i][0] += period[0];
         if (deform_vremap && mask[i] & deform_groupbit) v[i][0] += h_rate[0];
@@ -553,8 +558,10 @@ void Domain::pbc()
         image[i] = otherdims | idim;
       }
     }
+  }
 
-    if (yperiodic) {
+  if (yperiodic) {
+    for (i = 0; i < nlocal; i++) {
       if (x[i][1] < lo[1]) {
         x[i][1] += period[1];
         if (deform_vremap && mask[i] & deform_groupbit) {
@@ -581,8 +588,10 @@ void Domain::pbc()
         image[i] = otherdims | (idim << IMGBITS);
       }
     }
+  }
 
-    if (zperiodic) {
+  if (zperiodic) {
+    for (i = 0; i < nlocal; i++) {
       if (x[i][2] < lo[2]) {
         x[i][2] += period[2];
         if (deform_vremap && mask[i] & deform_groupbit) {
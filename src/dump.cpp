@@ -109,6 +109,14 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) : Pointers(lmp)
   xpbc = vpbc = NULL;
   imagepbc = NULL;
 
+  async_flag = 0;
+  async_started = 0;
+  async_pending = 0;
+  async_shutdown = 0;
+  maxasync = 0;
+  asyncbuf = NULL;
+  asyncfp = NULL;
+
   // parse filename for special syntax
   // if contains '%', write one file per proc and replace % with proc-ID
   // if contains '*', write one file per timestep and replace * with timestep
@@ -158,6 +166,9 @@ Dump::Dump(LAMMPS *lmp, int /*narg*/, char **arg) : Pointers(lmp)
 
 Dump::~Dump()
 {
+  if (async_started) async_stop();
+  memory->destroy(asyncbuf);
+
   delete [] id;
   delete [] style;
   delete [] filename;
@@ -218,6 +229,9 @@ void Dump::init()
 {
   init_style();
 
+  if (async_flag && (buffer_flag == 0 || binary || compressed))
+    error->all(FLERR,"Dump_modify async requires buffered text output");
+
   if (!sort_flag) {
     memory->destroy(bufsort);
     memory->destroy(ids);
@@ -338,6 +352,11 @@ void Dump::write()
 
   if (delay_flag && update->ntimestep < delaystep) return;
 
+  // wait for writer thread to finish previous snapshot
+  // so staging buffer and file pointer can be reused
+
+  if (async_started) async_wait();
+
   // if file per timestep, open new file
 
   if (multifile) openfile();
@@ -486,6 +505,7 @@ void Dump::write()
 
   } else {
     if (filewriter) {
+      int asyncchars = 0;
       for (int iproc = 0; iproc < nclusterprocs; iproc++) {
         if (iproc) {
           MPI_Irecv(sbuf,maxsbuf,MPI_CHAR,me+iproc,0,world,&request);
@@ -494,9 +514,20 @@ void Dump::write()
           MPI_Get_count(&status,MPI_CHAR,&nchars);
         } else nchars = nsme;
 
-        write_data(nchars,(double *) sbuf);
+        // async mode stages chunks for the writer thread instead of
+        //   writing them, all MPI stays on the main thread
+
+        if (async_flag) {
+          if (asyncchars + nchars > maxasync) {
+            maxasync = asyncchars + nchars;
+            memory->grow(asyncbuf,maxasync,"dump:asyncbuf");
+          }
+          memcpy(&asyncbuf[asyncchars],sbuf,nchars);
+          asyncchars += nchars;
+        } else write_data(nchars,(double *) sbuf);
       }
-      if (flush_flag && fp) fflush(fp);
+      if (async_flag) async_enqueue(asyncchars);
+      else if (flush_flag && fp) fflush(fp);
 
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
@@ -520,15 +551,100 @@ void Dump::write()
   // if file per timestep, close file if I am filewriter
 
   if (multifile) {
-    if (compressed) {
+    if (async_flag && filewriter) fp = NULL;     // writer thread closes file
+    else if (compressed) {
       if (filewriter && fp != NULL) pclose(fp);
+      fp = NULL;
     } else {
       if (filewriter && fp != NULL) fclose(fp);
+      fp = NULL;
     }
-    fp = NULL;
   }
 }
 
+/* ----------------------------------------------------------------------
+   writer thread main loop
+   waits for a queued snapshot, writes it, optionally flushes and
+     closes the file, then signals completion
+------------------------------------------------------------------------- */
+
+void *Dump::async_writer(void *ptr)
+{
+  Dump *dump = (Dump *) ptr;
+
+  pthread_mutex_lock(&dump->async_mutex);
+  while (1) {
+    while (!dump->async_pending && !dump->async_shutdown)
+      pthread_cond_wait(&dump->async_cond,&dump->async_mutex);
+    if (dump->async_shutdown) break;
+
+    fwrite(dump->asyncbuf,sizeof(char),dump->async_nchars,dump->asyncfp);
+    if (dump->async_flush) fflush(dump->asyncfp);
+    if (dump->async_close) fclose(dump->asyncfp);
+
+    dump->async_pending = 0;
+    pthread_cond_broadcast(&dump->async_cond);
+  }
+  pthread_mutex_unlock(&dump->async_mutex);
+  return NULL;
+}
+
+/* ----------------------------------------------------------------------
+   hand the staged snapshot to the writer thread and return immediately
+   starts the writer thread on first use
+------------------------------------------------------------------------- */
+
+void Dump::async_enqueue(int nchars)
+{
+  if (!async_started) {
+    pthread_mutex_init(&async_mutex,NULL);
+    pthread_cond_init(&async_cond,NULL);
+    if (pthread_create(&async_thread,NULL,async_writer,this))
+      error->one(FLERR,"Could not create dump writer thread");
+    async_started = 1;
+  }
+
+  pthread_mutex_lock(&async_mutex);
+  async_nchars = nchars;
+  asyncfp = fp;
+  async_close = multifile;
+  async_flush = flush_flag;
+  async_pending = 1;
+  pthread_cond_broadcast(&async_cond);
+  pthread_mutex_unlock(&async_mutex);
+}
+
+/* ----------------------------------------------------------------------
+   block until the writer thread has finished the previous snapshot
+------------------------------------------------------------------------- */
+
+void Dump::async_wait()
+{
+  pthread_mutex_lock(&async_mutex);
+  while (async_pending)
+    pthread_cond_wait(&async_cond,&async_mutex);
+  pthread_mutex_unlock(&async_mutex);
+}
+
+/* ----------------------------------------------------------------------
+   drain and shut down the writer thread
+------------------------------------------------------------------------- */
+
+void Dump::async_stop()
+{
+  async_wait();
+
+  pthread_mutex_lock(&async_mutex);
+  async_shutdown = 1;
+  pthread_cond_broadcast(&async_cond);
+  pthread_mutex_unlock(&async_mutex);
+  pthread_join(async_thread,NULL);
+
+  pthread_mutex_destroy(&async_mutex);
+  pthread_cond_destroy(&async_cond);
+  async_started = async_shutdown = 0;
+}
+
 /* ----------------------------------------------------------------------
    generic opening of a dump file
    ASCII or binary or gzipped
@@ -664,9 +780,14 @@ void Dump::sort()
         min = MIN(min,ids[i]);
         max = MAX(max,ids[i]);
       }
-      tagint minall,maxall;
-      MPI_Allreduce(&min,&minall,1,MPI_LMP_TAGINT,MPI_MIN,world);
-      MPI_Allreduce(&max,&maxall,1,MPI_LMP_TAGINT,MPI_MAX,world);
+      // find global min/max with one reduction by negating the min
+
+      tagint minmax[2],minmaxall[2];
+      minmax[0] = -min;
+      minmax[1] = max;
+      MPI_Allreduce(minmax,minmaxall,2,MPI_LMP_TAGINT,MPI_MAX,world);
+      tagint minall = -minmaxall[0];
+      tagint maxall = minmaxall[1];
 
       // use 0.5 instead of EPSILON since atom IDs are integers
       // if use EPSILON, it can be lost if 64-bit maxall-minall is too big
@@ -686,9 +807,14 @@ void Dump::sort()
         min = MIN(min,value);
         max = MAX(max,value);
       }
-      double minall,maxall;
-      MPI_Allreduce(&min,&minall,1,MPI_DOUBLE,MPI_MIN,world);
-      MPI_Allreduce(&max,&maxall,1,MPI_DOUBLE,MPI_MAX,world);
+      // find global min/max with one reduction by negating the min
+
+      double minmax[2],minmaxall[2];
+      minmax[0] = -min;
+      minmax[1] = max;
+      MPI_Allreduce(minmax,minmaxall,2,MPI_DOUBLE,MPI_MAX,world);
+      double minall = -minmaxall[0];
+      double maxall = minmaxall[1];
       double range = maxall-minall + EPSILON*(maxall-minall);
       if (range == 0.0) range = EPSILON;
 
@@ -919,6 +1045,18 @@ void Dump::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal dump_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) async_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) {
+        if (async_started) async_stop();
+        async_flag = 0;
+      }
+      else error->all(FLERR,"Illegal dump_modify command");
+      if (async_flag && buffer_allow == 0)
+        error->all(FLERR,"Dump_modify async yes not allowed for this style");
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"buffer") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) buffer_flag = 1;
@@ -1147,6 +1285,7 @@ bigint Dump::memory_usage()
 {
   bigint bytes = memory->usage(buf,size_one*maxbuf);
   bytes += memory->usage(sbuf,maxsbuf);
+  bytes += memory->usage(asyncbuf,maxasync);
   if (sort_flag) {
     if (sortcol == 0) bytes += memory->usage(ids,maxids);
     bytes += memory->usage(bufsort,size_one*maxsort);
@@ -16,6 +16,7 @@
 
 #include <mpi.h>
 #include <cstdio>
+#include <pthread.h>
 #include "pointers.h"
 
 namespace LAMMPS_NS {
@@ -134,6 +135,20 @@ class Dump : protected Pointers {
   imageint *imagepbc;
   int maxpbc;
 
+  int async_flag;            // 1 if writer thread performs file output
+  int async_started;         // 1 once writer thread is running
+  int async_pending;         // 1 if a snapshot is queued or being written
+  int async_shutdown;        // 1 tells writer thread to exit
+  int async_close;           // 1 if writer closes file after snapshot
+  int async_flush;           // 1 if writer flushes file after snapshot
+  int async_nchars;          // # of chars in queued snapshot
+  int maxasync;              // size of asyncbuf
+  char *asyncbuf;            // staging buffer handed to writer thread
+  FILE *asyncfp;             // file the queued snapshot is written to
+  pthread_t async_thread;
+  pthread_mutex_t async_mutex;
+  pthread_cond_t async_cond;
+
   class Irregular *irregular;
 
   virtual void init_style() = 0;
@@ -146,6 +161,11 @@ class Dump : protected Pointers {
   virtual void write_data(int, double *) = 0;
   void pbc_allocate();
 
+  void async_wait();
+  void async_enqueue(int);
+  void async_stop();
+  static void *async_writer(void *);
+
   void sort();
 #if defined(LMP_QSORT)
   static int idcompare(const void *, const void *);
@@ -0,0 +1,292 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <cstring>
+#include "dump_columnar.h"
+#include "domain.h"
+#include "update.h"
+#include "force.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+// file layout:
+//   magic, version, endian word, column label string
+//   per snapshot: header with per-column tolerances,
+//     then one encoded block per column
+//   index footer: (timestep,offset) pairs, counts, trailing magic
+// integer columns are zigzag-delta encoded as variable-length bytes,
+// double columns are stored as raw contiguous values, unless a
+//   tolerance was set for the column, in which case the values are
+//   rounded to multiples of the tolerance and the resulting integers
+//   are encoded the same way as an integer column
+// version 2 added the per-snapshot tolerances to the snapshot header
+
+#define DELTA 64
+
+#define COLUMNAR_MAGIC "LMPCOLD1"
+#define COLUMNAR_INDEX "COLINDEX"
+#define COLUMNAR_VERSION 2
+
+/* ---------------------------------------------------------------------- */
+
+DumpColumnar::DumpColumnar(LAMMPS *lmp, int narg, char **arg) :
+  DumpCustom(lmp, narg, arg)
+{
+  if (multifile)
+    error->all(FLERR,"Dump columnar cannot write one file per timestep");
+  if (compressed)
+    error->all(FLERR,"Dump columnar cannot write gzipped files");
+
+  binary = 1;
+  buffer_allow = 0;
+  buffer_flag = 0;
+
+  nsnap = maxsnap = 0;
+  steplist = offsetlist = NULL;
+
+  memory->create(quantize,size_one,"dump:quantize");
+  for (int i = 0; i < size_one; i++) quantize[i] = 0.0;
+  keyframe_every = 0;
+  keyframe_now = 0;
+
+  nlines_header = nlines_sofar = 0;
+  maxsnapbuf = 0;
+  snapbuf = NULL;
+  maxenc = 0;
+  encbuf = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+DumpColumnar::~DumpColumnar()
+{
+  if (filewriter && fp) write_footer();
+
+  memory->destroy(steplist);
+  memory->destroy(offsetlist);
+  memory->destroy(quantize);
+  memory->destroy(snapbuf);
+  memory->destroy(encbuf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void DumpColumnar::init_style()
+{
+  DumpCustom::init_style();
+}
+
+/* ----------------------------------------------------------------------
+   open the single dump file and write the file header once
+------------------------------------------------------------------------- */
+
+void DumpColumnar::openfile()
+{
+  if (singlefile_opened) return;
+  Dump::openfile();
+
+  if (filewriter && fp) {
+    int version = COLUMNAR_VERSION;
+    int endian = 1;
+    int n = strlen(columns);
+    fwrite(COLUMNAR_MAGIC,sizeof(char),8,fp);
+    fwrite(&version,sizeof(int),1,fp);
+    fwrite(&endian,sizeof(int),1,fp);
+    fwrite(&n,sizeof(int),1,fp);
+    fwrite(columns,sizeof(char),n,fp);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+int DumpColumnar::modify_param(int narg, char **arg)
+{
+  if (strcmp(arg[0],"quantize") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal dump_modify command");
+    if (strcmp(arg[1],"none") == 0) {
+      for (int i = 0; i < size_one; i++) quantize[i] = 0.0;
+      return 2;
+    }
+    if (narg < 3) error->all(FLERR,"Illegal dump_modify command");
+    int i = force->inumeric(FLERR,arg[1]) - 1;
+    if (i < 0 || i >= size_one)
+      error->all(FLERR,"Dump_modify quantize column is out of range");
+    if (vtype[i] != DOUBLE)
+      error->all(FLERR,"Dump_modify quantize column is not floating point");
+    double tolerance = force->numeric(FLERR,arg[2]);
+    if (tolerance <= 0.0) error->all(FLERR,"Illegal dump_modify command");
+    quantize[i] = tolerance;
+    return 3;
+  }
+
+  if (strcmp(arg[0],"keyframe") == 0) {
+    if (narg < 2) error->all(FLERR,"Illegal dump_modify command");
+    keyframe_every = force->inumeric(FLERR,arg[1]);
+    if (keyframe_every < 0) error->all(FLERR,"Illegal dump_modify command");
+    return 2;
+  }
+
+  return DumpCustom::modify_param(narg,arg);
+}
+
+/* ----------------------------------------------------------------------
+   record the snapshot offset for the index footer, write the
+     snapshot header, size the accumulation buffers
+------------------------------------------------------------------------- */
+
+void DumpColumnar::write_header(bigint ndump)
+{
+  if (!filewriter) return;
+
+  // every keyframe_every'th snapshot is written without quantization
+  // the header tolerances make each snapshot self-describing
+
+  keyframe_now = 0;
+  if (keyframe_every && nsnap % keyframe_every == 0) keyframe_now = 1;
+
+  if (nsnap == maxsnap) {
+    maxsnap += DELTA;
+    memory->grow(steplist,maxsnap,"dump:steplist");
+    memory->grow(offsetlist,maxsnap,"dump:offsetlist");
+  }
+  steplist[nsnap] = update->ntimestep;
+  offsetlist[nsnap] = (bigint) ftell(fp);
+  nsnap++;
+
+  bigint step = update->ntimestep;
+  int triclinic = domain->triclinic;
+  double box[9];
+  box[0] = boxxlo; box[1] = boxxhi;
+  box[2] = boxylo; box[3] = boxyhi;
+  box[4] = boxzlo; box[5] = boxzhi;
+  if (triclinic) {
+    box[6] = boxxy; box[7] = boxxz; box[8] = boxyz;
+  } else box[6] = box[7] = box[8] = 0.0;
+
+  fwrite(&step,sizeof(bigint),1,fp);
+  fwrite(&ndump,sizeof(bigint),1,fp);
+  fwrite(&triclinic,sizeof(int),1,fp);
+  fwrite(box,sizeof(double),9,fp);
+  fwrite(&size_one,sizeof(int),1,fp);
+  fwrite(vtype,sizeof(int),size_one,fp);
+
+  double tolerance;
+  for (int i = 0; i < size_one; i++) {
+    tolerance = keyframe_now ? 0.0 : quantize[i];
+    fwrite(&tolerance,sizeof(double),1,fp);
+  }
+
+  // size accumulation buffer for the whole snapshot
+  // varint encoding needs at most 10 bytes per value
+
+  if (ndump * size_one > MAXSMALLINT)
+    error->one(FLERR,"Too much per-proc info for dump");
+  if (ndump > maxsnapbuf) {
+    maxsnapbuf = static_cast<int> (ndump);
+    memory->grow(snapbuf,maxsnapbuf*size_one,"dump:snapbuf");
+    maxenc = (bigint) 10*maxsnapbuf;
+    memory->grow(encbuf,maxenc,"dump:encbuf");
+  }
+
+  nlines_header = ndump;
+  nlines_sofar = 0;
+}
+
+/* ----------------------------------------------------------------------
+   accumulate per-proc chunks, encode and write once complete
+------------------------------------------------------------------------- */
+
+void DumpColumnar::write_data(int n, double *mybuf)
+{
+  memcpy(&snapbuf[nlines_sofar*size_one],mybuf,n*size_one*sizeof(double));
+  nlines_sofar += n;
+  if (nlines_sofar == nlines_header) write_columns();
+}
+
+/* ----------------------------------------------------------------------
+   transpose the snapshot and write one encoded block per column
+------------------------------------------------------------------------- */
+
+void DumpColumnar::write_columns()
+{
+  int i;
+  bigint nbytes;
+  double tolerance;
+
+  int n = static_cast<int> (nlines_header);
+
+  for (int icol = 0; icol < size_one; icol++) {
+    tolerance = keyframe_now ? 0.0 : quantize[icol];
+
+    if (vtype[icol] == DOUBLE && tolerance == 0.0) {
+      double *column = (double *) encbuf;
+      for (i = 0; i < n; i++) column[i] = snapbuf[i*size_one + icol];
+      nbytes = (bigint) n*sizeof(double);
+
+    } else {
+
+      // integer or quantized double column: delta vs previous value,
+      //   zigzag to fold the sign bit, then 7-bit variable-length bytes
+      // quantized doubles are rounded to the nearest tolerance multiple,
+      //   readers reconstruct the value as integer times tolerance
+
+      int64_t value,prev,delta;
+      uint64_t u;
+      bigint m = 0;
+      prev = 0;
+      for (i = 0; i < n; i++) {
+        if (vtype[icol] == DOUBLE)
+          value = static_cast<int64_t>
+            (floor(snapbuf[i*size_one + icol]/tolerance + 0.5));
+        else value = static_cast<int64_t> (snapbuf[i*size_one + icol]);
+        delta = value - prev;
+        prev = value;
+        u = ((uint64_t) delta << 1) ^ (uint64_t) (delta >> 63);
+        while (u > 127) {
+          encbuf[m++] = (char) ((u & 127) | 128);
+          u >>= 7;
+        }
+        encbuf[m++] = (char) u;
+      }
+      nbytes = m;
+    }
+
+    fwrite(&nbytes,sizeof(bigint),1,fp);
+    fwrite(encbuf,sizeof(char),nbytes,fp);
+  }
+
+  if (flush_flag) fflush(fp);
+}
+
+/* ----------------------------------------------------------------------
+   append the index footer before the file is closed
+   readers locate it from the fixed-size trailer at end of file
+------------------------------------------------------------------------- */
+
+void DumpColumnar::write_footer()
+{
+  bigint footer_offset = (bigint) ftell(fp);
+
+  for (int i = 0; i < nsnap; i++) {
+    fwrite(&steplist[i],sizeof(bigint),1,fp);
+    fwrite(&offsetlist[i],sizeof(bigint),1,fp);
+  }
+
+  bigint bnsnap = nsnap;
+  fwrite(&bnsnap,sizeof(bigint),1,fp);
+  fwrite(&footer_offset,sizeof(bigint),1,fp);
+  fwrite(COLUMNAR_INDEX,sizeof(char),8,fp);
+}
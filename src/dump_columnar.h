@@ -0,0 +1,97 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef DUMP_CLASS
+
+DumpStyle(columnar,DumpColumnar)
+
+#else
+
+#ifndef LMP_DUMP_COLUMNAR_H
+#define LMP_DUMP_COLUMNAR_H
+
+#include "dump_custom.h"
+
+namespace LAMMPS_NS {
+
+class DumpColumnar : public DumpCustom {
+ public:
+  DumpColumnar(class LAMMPS *, int, char **);
+  virtual ~DumpColumnar();
+
+ protected:
+  int nsnap;                 // # of snapshots written to file
+  int maxsnap;               // size of steplist, offsetlist
+  bigint *steplist;          // timestep of each snapshot
+  bigint *offsetlist;        // file offset of each snapshot
+
+  double *quantize;          // per-column tolerance, 0.0 = full precision
+  int keyframe_every;        // every Nth snapshot is full precision, 0 = off
+  int keyframe_now;          // 1 if current snapshot is a keyframe
+
+  bigint nlines_header;      // # of lines announced for current snapshot
+  bigint nlines_sofar;       // # of lines accumulated so far
+  int maxsnapbuf;            // size of snapbuf in lines
+  double *snapbuf;           // accumulated snapshot, row major
+  bigint maxenc;             // size of encbuf in bytes
+  char *encbuf;              // encoded bytes for one column
+
+  void init_style();
+  void openfile();
+  int modify_param(int, char **);
+  void write_header(bigint);
+  void write_data(int, double *);
+
+  void write_columns();
+  void write_footer();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Dump columnar cannot write one file per timestep
+
+The columnar format appends an index footer for random timestep
+access, which requires all snapshots in one file.  Remove the '*'
+from the dump filename.
+
+E: Dump columnar cannot write gzipped files
+
+The columnar format is already a binary encoding.  Remove the .gz
+suffix from the dump filename.
+
+E: Dump_modify quantize column is out of range
+
+The column index must be from 1 to the number of per-atom quantities
+being output by the dump.
+
+E: Dump_modify quantize column is not floating point
+
+Integer columns are already stored exactly as variable-length bytes,
+so a quantization tolerance can only be set for a floating point
+column.
+
+E: Too much per-proc info for dump
+
+Number of local atoms times number of columns must fit in a 32-bit
+integer for dump.
+
+E: Cannot open dump file
+
+Self-explanatory.
+
+*/
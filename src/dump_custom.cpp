@@ -140,6 +140,17 @@ DumpCustom::DumpCustom(LAMMPS *lmp, int narg, char **arg) :
   size_one = nfield;
   ioptional = narg - noptional;
 
+  // fused packing if columns are exactly id type x y z,
+  // the most common choice, so pack() makes one pass over the atoms
+
+  fusedflag = 0;
+  if (size_one == 5 &&
+      pack_choice[0] == &DumpCustom::pack_id &&
+      pack_choice[1] == &DumpCustom::pack_type &&
+      pack_choice[2] == &DumpCustom::pack_x &&
+      pack_choice[3] == &DumpCustom::pack_y &&
+      pack_choice[4] == &DumpCustom::pack_z) fusedflag = 1;
+
   // atom selection arrays
 
   maxlocal = 0;
@@ -533,11 +544,21 @@ int DumpCustom::count()
 
     for (int ithresh = 0; ithresh < nthresh; ithresh++) {
 
+      // a threshold that compares to per-atom values stored on a
+      // previous step must fill dchoose for every atom, since an atom
+      // unselected now may be selected on a later step
+      // all other thresholds only need values for atoms still chosen,
+      // so the fill loops skip atoms already excluded by the group,
+      // region, or a previous threshold
+
+      int fillall = thresh_last[ithresh] >= 0;
+
       // customize by adding to if statement
 
       if (thresh_array[ithresh] == ID) {
         tagint *tag = atom->tag;
-        for (i = 0; i < nlocal; i++) dchoose[i] = tag[i];
+        for (i = 0; i < nlocal; i++)
+          if (fillall || choose[i]) dchoose[i] = tag[i];
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == MOL) {
@@ -545,25 +566,30 @@ int DumpCustom::count()
           error->all(FLERR,
                      "Threshold for an atom property that isn't allocated");
         tagint *molecule = atom->molecule;
-        for (i = 0; i < nlocal; i++) dchoose[i] = molecule[i];
+        for (i = 0; i < nlocal; i++)
+          if (fillall || choose[i]) dchoose[i] = molecule[i];
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == PROC) {
-        for (i = 0; i < nlocal; i++) dchoose[i] = me;
+        for (i = 0; i < nlocal; i++)
+          if (fillall || choose[i]) dchoose[i] = me;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == PROCP1) {
-        for (i = 0; i < nlocal; i++) dchoose[i] = me;
+        for (i = 0; i < nlocal; i++)
+          if (fillall || choose[i]) dchoose[i] = me;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == TYPE) {
         int *type = atom->type;
-        for (i = 0; i < nlocal; i++) dchoose[i] = type[i];
+        for (i = 0; i < nlocal; i++)
+          if (fillall || choose[i]) dchoose[i] = type[i];
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == ELEMENT) {
         int *type = atom->type;
-        for (i = 0; i < nlocal; i++) dchoose[i] = type[i];
+        for (i = 0; i < nlocal; i++)
+          if (fillall || choose[i]) dchoose[i] = type[i];
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == MASS) {
@@ -573,7 +599,8 @@ int DumpCustom::count()
         } else {
           double *mass = atom->mass;
           int *type = atom->type;
-          for (i = 0; i < nlocal; i++) dchoose[i] = mass[type[i]];
+          for (i = 0; i < nlocal; i++)
+            if (fillall || choose[i]) dchoose[i] = mass[type[i]];
           ptr = dchoose;
           nstride = 1;
         }
@@ -593,7 +620,8 @@ int DumpCustom::count()
         double boxxlo = domain->boxlo[0];
         double invxprd = 1.0/domain->xprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (x[i][0] - boxxlo) * invxprd;
+          if (fillall || choose[i])
+            dchoose[i] = (x[i][0] - boxxlo) * invxprd;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == YS) {
@@ -601,7 +629,8 @@ int DumpCustom::count()
         double boxylo = domain->boxlo[1];
         double invyprd = 1.0/domain->yprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (x[i][1] - boxylo) * invyprd;
+          if (fillall || choose[i])
+            dchoose[i] = (x[i][1] - boxylo) * invyprd;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == ZS) {
@@ -609,7 +638,8 @@ int DumpCustom::count()
         double boxzlo = domain->boxlo[2];
         double invzprd = 1.0/domain->zprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (x[i][2] - boxzlo) * invzprd;
+          if (fillall || choose[i])
+            dchoose[i] = (x[i][2] - boxzlo) * invzprd;
         ptr = dchoose;
         nstride = 1;
 
@@ -618,8 +648,9 @@ int DumpCustom::count()
         double *boxlo = domain->boxlo;
         double *h_inv = domain->h_inv;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = h_inv[0]*(x[i][0]-boxlo[0]) +
-            h_inv[5]*(x[i][1]-boxlo[1]) + h_inv[4]*(x[i][2]-boxlo[2]);
+          if (fillall || choose[i])
+            dchoose[i] = h_inv[0]*(x[i][0]-boxlo[0]) +
+              h_inv[5]*(x[i][1]-boxlo[1]) + h_inv[4]*(x[i][2]-boxlo[2]);
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == YSTRI) {
@@ -627,8 +658,9 @@ int DumpCustom::count()
         double *boxlo = domain->boxlo;
         double *h_inv = domain->h_inv;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = h_inv[1]*(x[i][1]-boxlo[1]) +
-            h_inv[3]*(x[i][2]-boxlo[2]);
+          if (fillall || choose[i])
+            dchoose[i] = h_inv[1]*(x[i][1]-boxlo[1]) +
+              h_inv[3]*(x[i][2]-boxlo[2]);
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == ZSTRI) {
@@ -636,7 +668,8 @@ int DumpCustom::count()
         double *boxlo = domain->boxlo;
         double *h_inv = domain->h_inv;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = h_inv[2]*(x[i][2]-boxlo[2]);
+          if (fillall || choose[i])
+            dchoose[i] = h_inv[2]*(x[i][2]-boxlo[2]);
         ptr = dchoose;
         nstride = 1;
 
@@ -645,7 +678,8 @@ int DumpCustom::count()
         imageint *image = atom->image;
         double xprd = domain->xprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = x[i][0] + ((image[i] & IMGMASK) - IMGMAX) * xprd;
+          if (fillall || choose[i])
+            dchoose[i] = x[i][0] + ((image[i] & IMGMASK) - IMGMAX) * xprd;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == YU) {
@@ -653,8 +687,9 @@ int DumpCustom::count()
         imageint *image = atom->image;
         double yprd = domain->yprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = x[i][1] +
-            ((image[i] >> IMGBITS & IMGMASK) - IMGMAX) * yprd;
+          if (fillall || choose[i])
+            dchoose[i] = x[i][1] +
+              ((image[i] >> IMGBITS & IMGMASK) - IMGMAX) * yprd;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == ZU) {
@@ -662,7 +697,8 @@ int DumpCustom::count()
         imageint *image = atom->image;
         double zprd = domain->zprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = x[i][2] + ((image[i] >> IMG2BITS) - IMGMAX) * zprd;
+          if (fillall || choose[i])
+            dchoose[i] = x[i][2] + ((image[i] >> IMG2BITS) - IMGMAX) * zprd;
         ptr = dchoose;
         nstride = 1;
 
@@ -672,6 +708,7 @@ int DumpCustom::count()
         double *h = domain->h;
         int xbox,ybox,zbox;
         for (i = 0; i < nlocal; i++) {
+          if (fillall == 0 && choose[i] == 0) continue;
           xbox = (image[i] & IMGMASK) - IMGMAX;
           ybox = (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
           zbox = (image[i] >> IMG2BITS) - IMGMAX;
@@ -685,6 +722,7 @@ int DumpCustom::count()
         double *h = domain->h;
         int ybox,zbox;
         for (i = 0; i < nlocal; i++) {
+          if (fillall == 0 && choose[i] == 0) continue;
           ybox = (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
           zbox = (image[i] >> IMG2BITS) - IMGMAX;
           dchoose[i] = x[i][1] + h[1]*ybox + h[3]*zbox;
@@ -697,6 +735,7 @@ int DumpCustom::count()
         double *h = domain->h;
         int zbox;
         for (i = 0; i < nlocal; i++) {
+          if (fillall == 0 && choose[i] == 0) continue;
           zbox = (image[i] >> IMG2BITS) - IMGMAX;
           dchoose[i] = x[i][2] + h[2]*zbox;
         }
@@ -709,8 +748,9 @@ int DumpCustom::count()
         double boxxlo = domain->boxlo[0];
         double invxprd = 1.0/domain->xprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (x[i][0] - boxxlo) * invxprd +
-            (image[i] & IMGMASK) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = (x[i][0] - boxxlo) * invxprd +
+              (image[i] & IMGMASK) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
 
@@ -720,9 +760,10 @@ int DumpCustom::count()
         double boxylo = domain->boxlo[1];
         double invyprd = 1.0/domain->yprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] =
-            (x[i][1] - boxylo) * invyprd +
-            (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] =
+              (x[i][1] - boxylo) * invyprd +
+              (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
 
@@ -732,8 +773,9 @@ int DumpCustom::count()
         double boxzlo = domain->boxlo[2];
         double invzprd = 1.0/domain->zprd;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (x[i][2] - boxzlo) * invzprd +
-            (image[i] >> IMG2BITS) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = (x[i][2] - boxzlo) * invzprd +
+              (image[i] >> IMG2BITS) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
 
@@ -743,10 +785,11 @@ int DumpCustom::count()
         double *boxlo = domain->boxlo;
         double *h_inv = domain->h_inv;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = h_inv[0]*(x[i][0]-boxlo[0]) +
-            h_inv[5]*(x[i][1]-boxlo[1]) +
-            h_inv[4]*(x[i][2]-boxlo[2]) +
-            (image[i] & IMGMASK) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = h_inv[0]*(x[i][0]-boxlo[0]) +
+              h_inv[5]*(x[i][1]-boxlo[1]) +
+              h_inv[4]*(x[i][2]-boxlo[2]) +
+              (image[i] & IMGMASK) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == YSUTRI) {
@@ -755,9 +798,10 @@ int DumpCustom::count()
         double *boxlo = domain->boxlo;
         double *h_inv = domain->h_inv;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = h_inv[1]*(x[i][1]-boxlo[1]) +
-            h_inv[3]*(x[i][2]-boxlo[2]) +
-            (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = h_inv[1]*(x[i][1]-boxlo[1]) +
+              h_inv[3]*(x[i][2]-boxlo[2]) +
+              (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == ZSUTRI) {
@@ -766,27 +810,31 @@ int DumpCustom::count()
         double *boxlo = domain->boxlo;
         double *h_inv = domain->h_inv;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = h_inv[2]*(x[i][2]-boxlo[2]) +
-            (image[i] >> IMG2BITS) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = h_inv[2]*(x[i][2]-boxlo[2]) +
+              (image[i] >> IMG2BITS) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
 
       } else if (thresh_array[ithresh] == IX) {
         imageint *image = atom->image;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (image[i] & IMGMASK) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = (image[i] & IMGMASK) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == IY) {
         imageint *image = atom->image;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = (image[i] >> IMGBITS & IMGMASK) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == IZ) {
         imageint *image = atom->image;
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = (image[i] >> IMG2BITS) - IMGMAX;
+          if (fillall || choose[i])
+            dchoose[i] = (image[i] >> IMG2BITS) - IMGMAX;
         ptr = dchoose;
         nstride = 1;
 
@@ -851,7 +899,8 @@ int DumpCustom::count()
           error->all(FLERR,
                      "Threshold for an atom property that isn't allocated");
         double *radius = atom->radius;
-        for (i = 0; i < nlocal; i++) dchoose[i] = 2.0*radius[i];
+        for (i = 0; i < nlocal; i++)
+          if (fillall || choose[i]) dchoose[i] = 2.0*radius[i];
         ptr = dchoose;
         nstride = 1;
       } else if (thresh_array[ithresh] == OMEGAX) {
@@ -948,7 +997,8 @@ int DumpCustom::count()
 
         int *ivector = atom->ivector[iwhich];
         for (i = 0; i < nlocal; i++)
-          dchoose[i] = ivector[i];
+          if (fillall || choose[i])
+            dchoose[i] = ivector[i];
         ptr = dchoose;
         nstride = 1;
       }
@@ -1058,7 +1108,25 @@ int DumpCustom::count()
 
 void DumpCustom::pack(tagint *ids)
 {
-  for (int n = 0; n < size_one; n++) (this->*pack_choice[n])(n);
+  if (fusedflag) {
+
+    // one pass filling all columns, instead of one pass per column
+
+    tagint *tag = atom->tag;
+    int *type = atom->type;
+    double **x = atom->x;
+    int j,m = 0;
+    for (int i = 0; i < nchoose; i++) {
+      j = clist[i];
+      buf[m++] = tag[j];
+      buf[m++] = type[j];
+      buf[m++] = x[j][0];
+      buf[m++] = x[j][1];
+      buf[m++] = x[j][2];
+    }
+
+  } else for (int n = 0; n < size_one; n++) (this->*pack_choice[n])(n);
+
   if (ids) {
     tagint *tag = atom->tag;
     for (int i = 0; i < nchoose; i++)
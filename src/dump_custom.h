@@ -48,6 +48,9 @@ class DumpCustom : public Dump {
   char **thresh_fixID;          // IDs of thresh_fixes
   int *thresh_first;            // 1 the first time a FixStore values accessed
 
+  int fusedflag;             // 1 if columns are id type x y z,
+                             // packed in one fused pass over atoms
+
   int expand;                // flag for whether field args were expanded
   char **earg;               // field names with wildcard expansion
   int nargnew;               // size of earg
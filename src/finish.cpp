@@ -33,6 +33,8 @@
 #include "neigh_list.h"
 #include "neigh_request.h"
 #include "output.h"
+#include "modify.h"
+#include "fix.h"
 #include "memory.h"
 #include "error.h"
 
@@ -50,6 +52,10 @@ static void mpi_timings(const char *label, Timer *t, enum Timer::ttype tt,
                         MPI_Comm world, const int nprocs, const int nthreads,
                         const int me, double time_loop, FILE *scr, FILE *log);
 
+static void fix_timings(const char *label, double time, MPI_Comm world,
+                        const int nprocs, const int me, double time_loop,
+                        FILE *scr, FILE *log);
+
 #ifdef LMP_USER_OMP
 static void omp_times(FixOMP *fix, const char *label, enum Timer::ttype which,
                       const int nthreads,FILE *scr, FILE *log);
@@ -533,6 +539,22 @@ void Finish::end(int flag)
     }
   }
 
+  // per-fix breakdown of the Modify bucket, only with full timer detail
+  // times are accumulated in the Modify hook loops
+
+  if (timeflag && timer->has_full() && modify->nfix) {
+    const char hdr[] = "\nFix timing breakdown:\n"
+      "Fix      |  min time  |  avg time  |  max time  |%varavg| %total\n"
+      "---------------------------------------------------------------\n";
+    if (me == 0) {
+      if (screen)  fputs(hdr,screen);
+      if (logfile) fputs(hdr,logfile);
+    }
+    for (i = 0; i < modify->nfix; i++)
+      fix_timings(modify->fix[i]->id,modify->fix[i]->walltime,
+                  world,nprocs,me,time_loop,screen,logfile);
+  }
+
 #ifdef LMP_USER_OMP
   const char thr_hdr_fmt[] =
     "\nThread timing breakdown (MPI rank %d):\nTotal threaded time %.4g / %.1f%%\n";
@@ -820,6 +842,9 @@ void Finish::end(int flag)
           fprintf(screen,"Dangerous builds = " BIGINT_FORMAT "\n",
                   neighbor->ndanger);
         else fprintf(screen,"Dangerous builds not checked\n");
+        if (neighbor->delta_flag)
+          fprintf(screen,"Delta-skipped builds = " BIGINT_FORMAT "\n",
+                  neighbor->ndelta_skip);
       }
       if (logfile) {
         if (nall < 2.0e9)
@@ -837,6 +862,9 @@ void Finish::end(int flag)
           fprintf(logfile,"Dangerous builds = " BIGINT_FORMAT "\n",
                   neighbor->ndanger);
         else fprintf(logfile,"Dangerous builds not checked\n");
+        if (neighbor->delta_flag)
+          fprintf(logfile,"Delta-skipped builds = " BIGINT_FORMAT "\n",
+                  neighbor->ndelta_skip);
       }
     }
   }
@@ -946,6 +974,37 @@ void mpi_timings(const char *label, Timer *t, enum Timer::ttype tt,
 
 /* ---------------------------------------------------------------------- */
 
+void fix_timings(const char *label, double time, MPI_Comm world,
+                 const int nprocs, const int me, double time_loop,
+                 FILE *scr, FILE *log)
+{
+  double tmp, time_max, time_min, time_sq;
+
+  MPI_Allreduce(&time,&time_min,1,MPI_DOUBLE,MPI_MIN,world);
+  MPI_Allreduce(&time,&time_max,1,MPI_DOUBLE,MPI_MAX,world);
+  time_sq = time*time;
+  MPI_Allreduce(&time,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+  time = tmp/nprocs;
+  MPI_Allreduce(&time_sq,&tmp,1,MPI_DOUBLE,MPI_SUM,world);
+  time_sq = tmp/nprocs;
+
+  // % variance from the average as measure of load imbalance
+
+  if ((time > 0.001) && ((time_sq/time - time) > 1.0e-10))
+    time_sq = sqrt(time_sq/time - time)*100.0;
+  else
+    time_sq = 0.0;
+
+  if (me == 0) {
+    const char fmt[] = "%-8s|%- 12.5g|%- 12.5g|%- 12.5g|%6.1f |%6.2f\n";
+    tmp = time/time_loop*100.0;
+    if (scr) fprintf(scr,fmt,label,time_min,time,time_max,time_sq,tmp);
+    if (log) fprintf(log,fmt,label,time_min,time,time_max,time_sq,tmp);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
 #ifdef LMP_USER_OMP
 void omp_times(FixOMP *fix, const char *label, enum Timer::ttype which,
                       const int nthreads,FILE *scr, FILE *log)
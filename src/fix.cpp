@@ -78,6 +78,7 @@ Fix::Fix(LAMMPS *lmp, int /*narg*/, char **arg) :
   enforce2d_flag = 0;
   respa_level_support = 0;
   respa_level = -1;
+  walltime = 0.0;
 
   scalar_flag = vector_flag = array_flag = 0;
   peratom_flag = local_flag = 0;
@@ -57,6 +57,9 @@ class Fix : protected Pointers {
   int respa_level_support;       // 1 if fix supports fix_modify respa
   int respa_level;               // which respa level to apply fix (1-Nrespa)
 
+  double walltime;               // wall time accumulated across this fix's
+                                 //   per-step methods, timer full mode only
+
   int scalar_flag;               // 0/1 if compute_scalar() function exists
   int vector_flag;               // 0/1 if compute_vector() function exists
   int array_flag;                // 0/1 if compute_array() function exists
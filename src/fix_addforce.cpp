@@ -239,6 +239,7 @@ void FixAddForce::post_force(int vflag)
   imageint *image = atom->image;
   double v[6];
   int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
   if (update->ntimestep % nevery) return;
 
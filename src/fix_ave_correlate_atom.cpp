@@ -0,0 +1,498 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include "fix_ave_correlate_atom.h"
+#include "atom.h"
+#include "update.h"
+#include "group.h"
+#include "domain.h"
+#include "modify.h"
+#include "fix_store.h"
+#include "memory.h"
+#include "error.h"
+#include "force.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+
+enum{MSD,VACF};
+enum{ONE,RUNNING};
+
+/* ---------------------------------------------------------------------- */
+
+FixAveCorrelateAtom::FixAveCorrelateAtom(LAMMPS * lmp, int narg, char **arg):
+  Fix (lmp, narg, arg),
+  which(NULL), fp(NULL), id_fix(NULL),
+  count(NULL), corr(NULL), save_count(NULL), save_corr(NULL)
+{
+  if (narg < 7) error->all(FLERR,"Illegal fix ave/correlate/atom command");
+
+  MPI_Comm_rank(world,&me);
+
+  nevery = force->inumeric(FLERR,arg[3]);
+  nrepeat = force->inumeric(FLERR,arg[4]);
+  nfreq = force->inumeric(FLERR,arg[5]);
+
+  global_freq = nfreq;
+
+  // parse values until one isn't recognized
+
+  which = new int[narg-6];
+  nvalues = 0;
+
+  int iarg = 6;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"msd") == 0) which[nvalues] = MSD;
+    else if (strcmp(arg[iarg],"vacf") == 0) which[nvalues] = VACF;
+    else break;
+    for (int i = 0; i < nvalues; i++)
+      if (which[i] == which[nvalues])
+        error->all(FLERR,
+                   "Fix ave/correlate/atom value specified more than once");
+    nvalues++;
+    iarg++;
+  }
+
+  if (nvalues == 0) error->all(FLERR,"Illegal fix ave/correlate/atom command");
+
+  // optional args
+
+  ave = ONE;
+  startstep = 0;
+  fp = NULL;
+  overwrite = 0;
+  char *title1 = NULL;
+  char *title2 = NULL;
+  char *title3 = NULL;
+
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"ave") == 0) {
+      if (iarg+2 > narg)
+        error->all(FLERR,"Illegal fix ave/correlate/atom command");
+      if (strcmp(arg[iarg+1],"one") == 0) ave = ONE;
+      else if (strcmp(arg[iarg+1],"running") == 0) ave = RUNNING;
+      else error->all(FLERR,"Illegal fix ave/correlate/atom command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"start") == 0) {
+      if (iarg+2 > narg)
+        error->all(FLERR,"Illegal fix ave/correlate/atom command");
+      startstep = force->inumeric(FLERR,arg[iarg+1]);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"file") == 0) {
+      if (iarg+2 > narg)
+        error->all(FLERR,"Illegal fix ave/correlate/atom command");
+      if (me == 0) {
+        fp = fopen(arg[iarg+1],"w");
+        if (fp == NULL) {
+          char str[128];
+          sprintf(str,"Cannot open fix ave/correlate/atom file %s",
+                  arg[iarg+1]);
+          error->one(FLERR,str);
+        }
+      }
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"overwrite") == 0) {
+      overwrite = 1;
+      iarg += 1;
+    } else if (strcmp(arg[iarg],"title1") == 0) {
+      if (iarg+2 > narg)
+        error->all(FLERR,"Illegal fix ave/correlate/atom command");
+      delete [] title1;
+      int n = strlen(arg[iarg+1]) + 1;
+      title1 = new char[n];
+      strcpy(title1,arg[iarg+1]);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"title2") == 0) {
+      if (iarg+2 > narg)
+        error->all(FLERR,"Illegal fix ave/correlate/atom command");
+      delete [] title2;
+      int n = strlen(arg[iarg+1]) + 1;
+      title2 = new char[n];
+      strcpy(title2,arg[iarg+1]);
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"title3") == 0) {
+      if (iarg+2 > narg)
+        error->all(FLERR,"Illegal fix ave/correlate/atom command");
+      delete [] title3;
+      int n = strlen(arg[iarg+1]) + 1;
+      title3 = new char[n];
+      strcpy(title3,arg[iarg+1]);
+      iarg += 2;
+    } else error->all(FLERR,"Illegal fix ave/correlate/atom command");
+  }
+
+  // setup and error check
+
+  if (nevery <= 0 || nrepeat <= 0 || nfreq <= 0)
+    error->all(FLERR,"Illegal fix ave/correlate/atom command");
+  if (nfreq % nevery)
+    error->all(FLERR,"Illegal fix ave/correlate/atom command");
+  if (ave == ONE && nfreq < (nrepeat-1)*nevery)
+    error->all(FLERR,"Illegal fix ave/correlate/atom command");
+  if (ave != RUNNING && overwrite)
+    error->all(FLERR,"Illegal fix ave/correlate/atom command");
+
+  // print file comment lines
+
+  if (fp && me == 0) {
+    clearerr(fp);
+    if (title1) fprintf(fp,"%s\n",title1);
+    else fprintf(fp,"# Per-atom time-correlated data for fix %s\n",id);
+    if (title2) fprintf(fp,"%s\n",title2);
+    else fprintf(fp,"# Timestep Number-of-time-windows\n");
+    if (title3) fprintf(fp,"%s\n",title3);
+    else {
+      fprintf(fp,"# Index TimeDelta Ncount");
+      for (int i = 0; i < nvalues; i++) {
+        if (which[i] == MSD) fprintf(fp," msd_x msd_y msd_z msd");
+        else fprintf(fp," vacf_x vacf_y vacf_z vacf");
+      }
+      fprintf(fp,"\n");
+    }
+    if (ferror(fp))
+      error->one(FLERR,"Error writing file header");
+
+    filepos = ftell(fp);
+  }
+
+  delete [] title1;
+  delete [] title2;
+  delete [] title3;
+
+  // allocate and initialize memory for averaging
+  // set count and corr to zero since they accumulate
+  // also set save versions to zero in case accessed via compute_array()
+
+  memory->create(count,nrepeat,"ave/correlate/atom:count");
+  memory->create(save_count,nrepeat,"ave/correlate/atom:save_count");
+  memory->create(corr,nrepeat,4*nvalues,"ave/correlate/atom:corr");
+  memory->create(save_corr,nrepeat,4*nvalues,"ave/correlate/atom:save_corr");
+
+  int i,j;
+  for (i = 0; i < nrepeat; i++) {
+    save_count[i] = count[i] = 0;
+    for (j = 0; j < 4*nvalues; j++)
+      save_corr[i][j] = corr[i][j] = 0.0;
+  }
+
+  // this fix produces a global array
+
+  array_flag = 1;
+  size_array_rows = nrepeat;
+  size_array_cols = 4*nvalues+2;
+  extarray = 0;
+
+  // nvalid = next step on which end_of_step does something
+
+  lastindex = -1;
+  firstindex = 0;
+  nsample = 0;
+  nvalid_last = -1;
+  nvalid = nextvalid();
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixAveCorrelateAtom::~FixAveCorrelateAtom()
+{
+  delete [] which;
+
+  memory->destroy(count);
+  memory->destroy(save_count);
+  memory->destroy(corr);
+  memory->destroy(save_corr);
+
+  if (fp && me == 0) fclose(fp);
+
+  // check nfix in case all fixes have already been deleted
+
+  if (id_fix && modify->nfix) modify->delete_fix(id_fix);
+  delete [] id_fix;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixAveCorrelateAtom::setmask()
+{
+  int mask = 0;
+  mask |= END_OF_STEP;
+  return mask;
+}
+
+/* ----------------------------------------------------------------------
+   create a fix STORE for the ring buffer of per-atom samples
+   one shared store holds nrepeat samples of 3 values per quantity,
+     so the history migrates with the atoms
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::post_constructor()
+{
+  int n = strlen(id) + strlen("_FIX_STORE") + 1;
+  id_fix = new char[n];
+  strcpy(id_fix,id);
+  strcat(id_fix,"_FIX_STORE");
+
+  char nstr[16];
+  sprintf(nstr,"%d",3*nvalues*nrepeat);
+
+  char **newarg = new char*[6];
+  newarg[0] = id_fix;
+  newarg[1] = group->names[igroup];
+  newarg[2] = (char *) "STORE";
+  newarg[3] = (char *) "peratom";
+  newarg[4] = (char *) "0";
+  newarg[5] = nstr;
+  modify->add_fix(6,newarg);
+  fix = (FixStore *) modify->fix[modify->nfix-1];
+  delete [] newarg;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::init()
+{
+  // set fix which stores the per-atom sample history
+
+  int ifix = modify->find_fix(id_fix);
+  if (ifix < 0)
+    error->all(FLERR,"Could not find fix ave/correlate/atom fix ID");
+  fix = (FixStore *) modify->fix[ifix];
+
+  // ngroup = # of atoms in group, assumed to persist for the run
+
+  ngroup = group->count(igroup);
+
+  // need to reset nvalid if nvalid < ntimestep b/c minimize was performed
+
+  if (nvalid < update->ntimestep) {
+    lastindex = -1;
+    firstindex = 0;
+    nsample = 0;
+    nvalid = nextvalid();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   only does something if nvalid = current timestep
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::setup(int /*vflag*/)
+{
+  end_of_step();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::end_of_step()
+{
+  int i,j,iv,offset;
+
+  // skip if not step which requires doing something
+  // error check if timestep was reset in an invalid manner
+
+  bigint ntimestep = update->ntimestep;
+  if (ntimestep < nvalid_last || ntimestep > nvalid)
+    error->all(FLERR,"Invalid timestep reset for fix ave/correlate/atom");
+  if (ntimestep != nvalid) return;
+  nvalid_last = nvalid;
+
+  // lastindex = index in sample ring of latest time sample
+  // store unwrapped coords and/or velocities of group atoms in the ring
+
+  lastindex++;
+  if (lastindex == nrepeat) lastindex = 0;
+
+  double **astore = fix->astore;
+  double **x = atom->x;
+  double **v = atom->v;
+  int *mask = atom->mask;
+  imageint *image = atom->image;
+  int nlocal = atom->nlocal;
+
+  for (iv = 0; iv < nvalues; iv++) {
+    offset = (lastindex*nvalues + iv)*3;
+    if (which[iv] == MSD) {
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit)
+          domain->unmap(x[i],image[i],&astore[i][offset]);
+    } else {
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) {
+          astore[i][offset] = v[i][0];
+          astore[i][offset+1] = v[i][1];
+          astore[i][offset+2] = v[i][2];
+        }
+    }
+  }
+
+  // firstindex = index in sample ring of earliest time sample
+  // nsample = number of time samples in sample ring
+
+  if (nsample < nrepeat) nsample++;
+  else {
+    firstindex++;
+    if (firstindex == nrepeat) firstindex = 0;
+  }
+
+  nvalid += nevery;
+
+  // calculate all C(dt) enabled by latest sample
+
+  accumulate();
+  if (ntimestep % nfreq) return;
+
+  // sum local accumulation across procs in one batched reduction
+  // save normalized results in save_count and save_corr
+
+  MPI_Allreduce(&corr[0][0],&save_corr[0][0],nrepeat*4*nvalues,
+                MPI_DOUBLE,MPI_SUM,world);
+
+  double norm;
+  for (i = 0; i < nrepeat; i++) {
+    save_count[i] = count[i];
+    if (count[i] && ngroup > 0.0) {
+      norm = 1.0/(count[i]*ngroup);
+      for (j = 0; j < 4*nvalues; j++) save_corr[i][j] *= norm;
+    } else
+      for (j = 0; j < 4*nvalues; j++) save_corr[i][j] = 0.0;
+  }
+
+  // output result to file
+
+  if (fp && me == 0) {
+    clearerr(fp);
+    if (overwrite) fseek(fp,filepos,SEEK_SET);
+    fprintf(fp,BIGINT_FORMAT " %d\n",ntimestep,nrepeat);
+    for (i = 0; i < nrepeat; i++) {
+      fprintf(fp,"%d %d %d",i+1,i*nevery,count[i]);
+      for (j = 0; j < 4*nvalues; j++) fprintf(fp," %g",save_corr[i][j]);
+      fprintf(fp,"\n");
+    }
+    if (ferror(fp))
+      error->one(FLERR,"Error writing out correlation data");
+
+    fflush(fp);
+
+    if (overwrite) {
+      long fileend = ftell(fp);
+      if (fileend > 0) ftruncate(fileno(fp),fileend);
+    }
+  }
+
+  // zero accumulation if requested
+  // recalculate C(0) from the latest sample
+
+  if (ave == ONE) {
+    for (i = 0; i < nrepeat; i++) {
+      count[i] = 0;
+      for (j = 0; j < 4*nvalues; j++)
+        corr[i][j] = 0.0;
+    }
+    nsample = 1;
+    accumulate();
+  }
+}
+
+/* ----------------------------------------------------------------------
+   accumulate correlation data using the most recently added sample
+   one sweep over owned atoms covers all stored time origins, each
+     atom's history is one contiguous row of the fix STORE array
+   sums are local, reduced across procs only at Nfreq output
+------------------------------------------------------------------------- */
+
+void FixAveCorrelateAtom::accumulate()
+{
+  int i,k,m,iv,ipair;
+  double dx,dy,dz,cx,cy,cz;
+
+  for (k = 0; k < nsample; k++) count[k]++;
+
+  double **astore = fix->astore;
+  int *mask = atom->mask;
+  int nlocal = atom->nlocal;
+
+  int stride = 3*nvalues;
+
+  for (i = 0; i < nlocal; i++) {
+    if (!(mask[i] & groupbit)) continue;
+    double *h = astore[i];
+    double *latest = &h[lastindex*stride];
+
+    m = lastindex;
+    for (k = 0; k < nsample; k++) {
+      double *origin = &h[m*stride];
+      ipair = 0;
+      for (iv = 0; iv < nvalues; iv++) {
+        if (which[iv] == MSD) {
+          dx = latest[3*iv] - origin[3*iv];
+          dy = latest[3*iv+1] - origin[3*iv+1];
+          dz = latest[3*iv+2] - origin[3*iv+2];
+          corr[k][ipair] += dx*dx;
+          corr[k][ipair+1] += dy*dy;
+          corr[k][ipair+2] += dz*dz;
+          corr[k][ipair+3] += dx*dx + dy*dy + dz*dz;
+        } else {
+          cx = latest[3*iv] * origin[3*iv];
+          cy = latest[3*iv+1] * origin[3*iv+1];
+          cz = latest[3*iv+2] * origin[3*iv+2];
+          corr[k][ipair] += cx;
+          corr[k][ipair+1] += cy;
+          corr[k][ipair+2] += cz;
+          corr[k][ipair+3] += cx + cy + cz;
+        }
+        ipair += 4;
+      }
+      m--;
+      if (m < 0) m = nrepeat-1;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+   return I,J array value
+------------------------------------------------------------------------- */
+
+double FixAveCorrelateAtom::compute_array(int i, int j)
+{
+  if (j == 0) return 1.0*i*nevery;
+  else if (j == 1) return 1.0*save_count[i];
+  return save_corr[i][j-2];
+}
+
+/* ----------------------------------------------------------------------
+   nvalid = next step on which end_of_step does something
+   this step if multiple of nevery, else next multiple
+   startstep is lower bound
+------------------------------------------------------------------------- */
+
+bigint FixAveCorrelateAtom::nextvalid()
+{
+  bigint nvalid = update->ntimestep;
+  if (startstep > nvalid) nvalid = startstep;
+  if (nvalid % nevery) nvalid = (nvalid/nevery)*nevery + nevery;
+  return nvalid;
+}
+
+/* ----------------------------------------------------------------------
+   memory usage of accumulators, sample ring is tallied by the fix STORE
+------------------------------------------------------------------------- */
+
+double FixAveCorrelateAtom::memory_usage()
+{
+  double bytes = 2.0*nrepeat*4*nvalues * sizeof(double);
+  bytes += 2.0*nrepeat * sizeof(int);
+  return bytes;
+}
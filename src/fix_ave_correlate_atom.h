@@ -0,0 +1,109 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(ave/correlate/atom,FixAveCorrelateAtom)
+
+#else
+
+#ifndef LMP_FIX_AVE_CORRELATE_ATOM_H
+#define LMP_FIX_AVE_CORRELATE_ATOM_H
+
+#include <cstdio>
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixAveCorrelateAtom : public Fix {
+ public:
+  FixAveCorrelateAtom(class LAMMPS *, int, char **);
+  ~FixAveCorrelateAtom();
+  int setmask();
+  void post_constructor();
+  void init();
+  void setup(int);
+  void end_of_step();
+  double compute_array(int,int);
+  double memory_usage();
+
+ private:
+  int me,nvalues;
+  int nrepeat,nfreq;
+  bigint nvalid,nvalid_last;
+  int *which;
+  FILE *fp;
+
+  int ave,startstep,overwrite;
+  long filepos;
+
+  char *id_fix;        // ID of internally created fix STORE
+  class FixStore *fix; // ring buffer of per-atom samples, one row per
+                       //   atom: nrepeat slots of 3 values per quantity
+
+  int firstindex;      // index in sample ring of earliest time sample
+  int lastindex;       // index in sample ring of latest time sample
+  int nsample;         // number of time samples in sample ring
+
+  double ngroup;       // # of atoms in group, set in init()
+  int *count;
+  double **corr;       // local accumulation, summed across procs at Nfreq
+
+  int *save_count;     // saved values at Nfreq for output via compute_array()
+  double **save_corr;
+
+  void accumulate();
+  bigint nextvalid();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Cannot open fix ave/correlate/atom file %s
+
+The specified file cannot be opened.  Check that the path and name are
+correct.
+
+E: Fix ave/correlate/atom value specified more than once
+
+Each of the msd and vacf values can be listed at most once.
+
+E: Could not find fix ave/correlate/atom fix ID
+
+The internally created fix STORE holding the sample history was
+deleted, which is not allowed.
+
+E: Invalid timestep reset for fix ave/correlate/atom
+
+Resetting the timestep has invalidated the sequence of timesteps this
+fix needs to process.
+
+E: Error writing file header
+
+Something in the output to the file triggered an error.
+
+E: Error writing out correlation data
+
+Something in the output to the file triggered an error.
+
+*/
@@ -210,6 +210,7 @@ void FixAveForce::post_force(int /*vflag*/)
   double **f = atom->f;
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
   double foriginal[4];
   foriginal[0] = foriginal[1] = foriginal[2] = foriginal[3] = 0.0;
@@ -276,6 +277,7 @@ void FixAveForce::post_force_respa(int vflag, int ilevel, int /*iloop*/)
     double **f = atom->f;
     int *mask = atom->mask;
     int nlocal = atom->nlocal;
+    if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
     double foriginal[4];
     foriginal[0] = foriginal[1] = foriginal[2] = foriginal[3] = 0.0;
@@ -884,6 +884,29 @@ void FixDeform::end_of_step()
     }
   }
 
+  // detect pure tilt change: triclinic box whose edge lengths are all
+  //   unchanged this step, e.g. steady shear
+  // then the remap is just adding the tilt increments scaled by the
+  //   atom's lamda coords, one sweep instead of the x2lamda/lamda2x pair
+
+  int tiltonly = 0;
+  double dyz = 0.0;
+  double dxz = 0.0;
+  double dxy = 0.0;
+
+  if (triclinic && remapflag == Domain::X_REMAP) {
+    tiltonly = 1;
+    for (i = 0; i < 3; i++)
+      if (set[i].style &&
+          (set[i].lo_target != domain->boxlo[i] ||
+           set[i].hi_target != domain->boxhi[i])) tiltonly = 0;
+    if (tiltonly) {
+      if (set[3].style) dyz = set[3].tilt_target - domain->yz;
+      if (set[4].style) dxz = set[4].tilt_target - domain->xz;
+      if (set[5].style) dxy = set[5].tilt_target - domain->xy;
+    }
+  }
+
   // convert atoms and rigid bodies to lamda coords
 
   if (remapflag == Domain::X_REMAP) {
@@ -891,9 +914,22 @@ void FixDeform::end_of_step()
     int *mask = atom->mask;
     int nlocal = atom->nlocal;
 
-    for (i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit)
-        domain->x2lamda(x[i],x[i]);
+    if (tiltonly) {
+      double *boxlo = domain->boxlo;
+      double *h_inv = domain->h_inv;
+      double lamday,lamdaz;
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) {
+          lamday = h_inv[1]*(x[i][1]-boxlo[1]) + h_inv[3]*(x[i][2]-boxlo[2]);
+          lamdaz = h_inv[2]*(x[i][2]-boxlo[2]);
+          x[i][0] += dxy*lamday + dxz*lamdaz;
+          x[i][1] += dyz*lamdaz;
+        }
+    } else {
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit)
+          domain->x2lamda(x[i],x[i]);
+    }
 
     if (nrigid)
       for (i = 0; i < nrigid; i++)
@@ -925,15 +961,17 @@ void FixDeform::end_of_step()
   domain->set_local_box();
 
   // convert atoms and rigid bodies back to box coords
+  // atoms remapped via the pure tilt fast path are already in box coords
 
   if (remapflag == Domain::X_REMAP) {
     double **x = atom->x;
     int *mask = atom->mask;
     int nlocal = atom->nlocal;
 
-    for (i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit)
-        domain->lamda2x(x[i],x[i]);
+    if (!tiltonly)
+      for (i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit)
+          domain->lamda2x(x[i],x[i]);
 
     if (nrigid)
       for (i = 0; i < nrigid; i++)
@@ -99,6 +99,7 @@ void FixDrag::post_force(int /*vflag*/)
   double **f = atom->f;
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
   ftotal[0] = ftotal[1] = ftotal[2] = 0.0;
   force_flag = 0;
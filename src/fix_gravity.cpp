@@ -272,6 +272,7 @@ void FixGravity::post_force(int /*vflag*/)
   int *mask = atom->mask;
   int *type = atom->type;
   int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
   double massone;
 
   eflag = 0;
@@ -33,7 +33,7 @@ using namespace FixConst;
 /* ---------------------------------------------------------------------- */
 
 FixGroup::FixGroup(LAMMPS *lmp, int narg, char **arg) : Fix(lmp, narg, arg),
-idregion(NULL), idvar(NULL), idprop(NULL)
+idregion(NULL), idvar(NULL), idprop(NULL), varatom(NULL), maxvar(0)
 {
   // dgroupbit = bitmask of dynamic group
   // group ID is last part of fix ID
@@ -100,6 +100,7 @@ FixGroup::~FixGroup()
   delete [] idregion;
   delete [] idvar;
   delete [] idprop;
+  memory->destroy(varatom);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -216,7 +217,12 @@ void FixGroup::set_group()
   if (varflag) {
     update->post_integrate = 1;
     modify->clearstep_compute();
-    memory->create(var,nlocal,"fix/group:varvalue");
+    if (atom->nmax > maxvar) {
+      maxvar = atom->nmax;
+      memory->destroy(varatom);
+      memory->create(varatom,maxvar,"fix/group:varatom");
+    }
+    var = varatom;
     input->variable->compute_atom(ivar,igroup,var,1,0);
     modify->addstep_compute(update->ntimestep + nevery);
     update->post_integrate = 0;
@@ -236,6 +242,11 @@ void FixGroup::set_group()
   // only in group if in parent group, in region, variable is non-zero
   // if compute, fix, etc needs updated masks of ghost atoms,
   // it must do forward_comm() to update them
+  // this is a full sweep by design: region membership has no incremental
+  //   form (match() is the only predicate, there is no signed distance to
+  //   amortize against displacement) and atom-style variables are opaque,
+  //   so a dirty list cannot know which atoms to re-test
+  // the cost knob is the every keyword, which bounds the staleness instead
 
   double **x = atom->x;
   int *mask = atom->mask;
@@ -253,8 +264,6 @@ void FixGroup::set_group()
     if (inflag) mask[i] |= gbit;
     else mask[i] &= gbitinverse;
   }
-
-  if (varflag) memory->destroy(var);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -42,6 +42,9 @@ class FixGroup : public Fix {
   char *idregion,*idvar,*idprop;
   class Region *region;
 
+  double *varatom;       // persistent buffer for atom-style variable
+  int maxvar;            // allocated length of varatom
+
   int nlevels_respa;
 
   void set_group();
@@ -470,6 +470,13 @@ void FixLangevin::post_force_untemplated
   int nlocal = atom->nlocal;
 
   // apply damping and thermostat to atoms in group
+  // drag and random forces are fused in a single sweep over owned atoms,
+  //   and the templated instantiation compiles the per-style tests away
+  // random kicks are uniform deviates, not gaussians, by design:
+  //   the sqrt(24 kT) prefactor gives the variance the fluctuation-
+  //   dissipation theorem requires, which is all the thermostat samples,
+  //   and RanMars::uniform() is branch-free where gaussian() must loop
+  //   on rejection
 
   // for Tp_TSTYLEATOM:
   //   use per-atom per-coord target temperature
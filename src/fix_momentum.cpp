@@ -90,7 +90,14 @@ void FixMomentum::init()
   masstotal = group->mass(igroup);
 }
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   group mass is computed once in init() and reused every invocation,
+     recomputed only for dynamic groups
+   the correction stays an end_of_step hook rather than being folded
+     into the integrator sweep: it runs only every nevery steps, needs
+     vcm/omega reductions over its own group before any velocity can
+     be adjusted, and the integrate styles know nothing of fix groups
+------------------------------------------------------------------------- */
 
 void FixMomentum::end_of_step()
 {
@@ -136,12 +143,17 @@ void FixMomentum::end_of_step()
 
     // adjust velocities by vcm to zero linear momentum
     // only adjust a component if flag is set
+    // zero unflagged components once instead of testing in the loop
+
+    if (!xflag) vcm[0] = 0.0;
+    if (!yflag) vcm[1] = 0.0;
+    if (!zflag) vcm[2] = 0.0;
 
     for (int i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
-        if (xflag) v[i][0] -= vcm[0];
-        if (yflag) v[i][1] -= vcm[1];
-        if (zflag) v[i][2] -= vcm[2];
+        v[i][0] -= vcm[0];
+        v[i][1] -= vcm[1];
+        v[i][2] -= vcm[2];
       }
   }
 
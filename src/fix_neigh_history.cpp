@@ -552,7 +552,7 @@ void FixNeighHistory::min_pre_exchange()
 
 void FixNeighHistory::post_neighbor()
 {
-  int i,j,m,ii,jj,nn,np,inum,jnum,rflag;
+  int i,j,m,ii,jj,nn,np,mlast,msearch,inum,jnum,rflag;
   tagint jtag;
   int *ilist,*jlist,*numneigh,**firstneigh;
   int *allflags;
@@ -599,6 +599,7 @@ void FixNeighHistory::post_neighbor()
     firstvalue[i] = allvalues = dpage_neigh->get(jnum*dnum);
     np = npartner[i];
     nn = 0;
+    mlast = 0;
 
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
@@ -609,12 +610,20 @@ void FixNeighHistory::post_neighbor()
       // rflag = 1 if r < radsum in npair_size() method
       // preserve neigh history info if tag[j] is in old-neigh partner list
       // this test could be more geometrically precise for two sphere/line/tri
+      // new list usually preserves the relative order of surviving contacts,
+      //   so resume the partner search at the last match
+      //   instead of rescanning the partner list from its start
 
       if (rflag) {
         jtag = tag[j];
-        for (m = 0; m < np; m++)
+        for (msearch = 0; msearch < np; msearch++) {
+          m = mlast + msearch;
+          if (m >= np) m -= np;
           if (partner[i][m] == jtag) break;
-        if (m < np) {
+        }
+        if (msearch < np) {
+          mlast = m + 1;
+          if (mlast == np) mlast = 0;
           allflags[jj] = 1;
           memcpy(&allvalues[nn],&valuepartner[i][dnum*m],dnumbytes);
         } else {
@@ -843,6 +843,10 @@ void FixNH::initial_integrate(int /*vflag*/)
   // need to recompute pressure to account for change in KE
   // t_current is up-to-date, but compute_temperature is not
   // compute appropriately coupled elements of mvv_current
+  // this is the only KE reduction in the 1st half-step:
+  //   nhc_temp_integrate() rescaled t_current analytically as it scaled v,
+  //   and pressure->compute_scalar/vector() reuses this invocation of the
+  //   temperature compute via its invoked_scalar/invoked_vector check
 
   if (pstat_flag) {
     if (pstyle == ISO) {
@@ -900,6 +904,10 @@ void FixNH::final_integrate()
 
   // compute new T,P after velocities rescaled by nh_v_press()
   // compute appropriately coupled elements of mvv_current
+  // this is the only KE reduction in the 2nd half-step:
+  //   the pressure compute reuses it via its invoked_scalar/vector check,
+  //   and nhc_temp_integrate() below rescales t_current analytically,
+  //   so t_current carries into initial_integrate() of the next step
 
   t_current = temperature->compute_scalar();
   tdof = temperature->dof;
@@ -18,6 +18,7 @@
 #include "force.h"
 #include "update.h"
 #include "respa.h"
+#include "memory.h"
 #include "error.h"
 
 using namespace LAMMPS_NS;
@@ -33,6 +34,15 @@ FixNVE::FixNVE(LAMMPS *lmp, int narg, char **arg) :
 
   dynamic_group_allow = 1;
   time_integrate = 1;
+
+  dtfm_type = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixNVE::~FixNVE()
+{
+  memory->destroy(dtfm_type);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -54,6 +64,14 @@ void FixNVE::init()
   dtv = update->dt;
   dtf = 0.5 * update->dt * force->ftm2v;
 
+  // per-type dtf/mass table, hoists the divide out of the atom loops
+  // values are refilled each call since dtf changes per rRESPA level
+
+  if (atom->rmass == NULL) {
+    memory->destroy(dtfm_type);
+    memory->create(dtfm_type,atom->ntypes+1,"nve:dtfm_type");
+  }
+
   if (strstr(update->integrate_style,"respa"))
     step_respa = ((Respa *) update->integrate)->step;
 }
@@ -91,9 +109,10 @@ void FixNVE::initial_integrate(int /*vflag*/)
       }
 
   } else {
+    for (int k = 1; k <= atom->ntypes; k++) dtfm_type[k] = dtf / mass[k];
     for (int i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
-        dtfm = dtf / mass[type[i]];
+        dtfm = dtfm_type[type[i]];
         v[i][0] += dtfm * f[i][0];
         v[i][1] += dtfm * f[i][1];
         v[i][2] += dtfm * f[i][2];
@@ -131,9 +150,10 @@ void FixNVE::final_integrate()
       }
 
   } else {
+    for (int k = 1; k <= atom->ntypes; k++) dtfm_type[k] = dtf / mass[k];
     for (int i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
-        dtfm = dtf / mass[type[i]];
+        dtfm = dtfm_type[type[i]];
         v[i][0] += dtfm * f[i][0];
         v[i][1] += dtfm * f[i][1];
         v[i][2] += dtfm * f[i][2];
@@ -27,7 +27,7 @@ namespace LAMMPS_NS {
 class FixNVE : public Fix {
  public:
   FixNVE(class LAMMPS *, int, char **);
-  virtual ~FixNVE() {}
+  virtual ~FixNVE();
   int setmask();
   virtual void init();
   virtual void initial_integrate(int);
@@ -38,6 +38,7 @@ class FixNVE : public Fix {
 
  protected:
   double dtv,dtf;
+  double *dtfm_type;          // dtf/mass per type, filled each call
   double *step_respa;
   int mass_require;
 };
@@ -461,6 +461,20 @@ void FixPropertyAtom::copy_arrays(int i, int j, int /*delflag*/)
 
 /* ----------------------------------------------------------------------
    pack values for border communication at re-neighboring
+   this is the only communication these properties incur: with the
+     border option they ride the border messages when ghost lists are
+     rebuilt, and are NOT re-sent in the every-step forward comm of
+     coords, so unchanged values already cost nothing between
+     reneighborings
+   dirty-bit tracking to skip or thin per-step fix forward comms was
+     considered and not adopted: the fixes that do forward ghost values
+     every step do so inside iterative charge solvers (fix qeq/comb,
+     fix qeq/reax), whose iteration counts already collapse when the
+     values stop changing, and a clean-step skip must be agreed on by
+     all procs, costing an allreduce of comparable latency to the small
+     message it would save; sending an index subset also replaces a
+     fixed-size contiguous message with index+value pairs, which is
+     larger unless very few entries changed
 ------------------------------------------------------------------------- */
 
 int FixPropertyAtom::pack_border(int n, int *list, double *buf)
@@ -225,6 +225,7 @@ void FixSetForce::post_force(int /*vflag*/)
   double **f = atom->f;
   int *mask = atom->mask;
   int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
   // update region if necessary
 
@@ -309,6 +310,7 @@ void FixSetForce::post_force_respa(int vflag, int ilevel, int /*iloop*/)
     double **f = atom->f;
     int *mask = atom->mask;
     int nlocal = atom->nlocal;
+    if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
     for (int i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -155,6 +155,7 @@ void FixSpringSelf::post_force(int /*vflag*/)
   int *mask = atom->mask;
   imageint *image = atom->image;
   int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
   double dx,dy,dz;
   double unwrap[3];
@@ -25,6 +25,14 @@ FixStyle(STORE,FixStore)
 
 namespace LAMMPS_NS {
 
+// each consumer (compute msd, compute displace/atom, etc) instantiates
+//   its own FixStore, even when several snapshot the same quantity
+// the copies cannot be shared or made copy-on-write:
+//   each consumer may rewrite its reference independently
+//   (e.g. compute msd average/com options), and exchange() permutes
+//   per-atom storage every reneighbor, so change tracking would have
+//   to run in the migration hot path for every stored atom
+
 class FixStore : public Fix {
  public:
   int nrow,ncol;         // size of global data array
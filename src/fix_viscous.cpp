@@ -120,6 +120,7 @@ void FixViscous::post_force(int /*vflag*/)
   int *mask = atom->mask;
   int *type = atom->type;
   int nlocal = atom->nlocal;
+  if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
   double drag;
 
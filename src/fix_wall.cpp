@@ -22,9 +22,12 @@
 #include "lattice.h"
 #include "update.h"
 #include "modify.h"
+#include "neighbor.h"
+#include "group.h"
 #include "respa.h"
 #include "error.h"
 #include "force.h"
+#include "memory.h"
 
 using namespace LAMMPS_NS;
 using namespace FixConst;
@@ -196,6 +199,9 @@ FixWall::FixWall(LAMMPS *lmp, int narg, char **arg) :
 
   eflag = 0;
   for (int m = 0; m <= nwall; m++) ewall[m] = 0.0;
+
+  for (int m = 0; m < 6; m++) wlist[m] = NULL;
+  maxwlist = 0;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -209,6 +215,8 @@ FixWall::~FixWall()
     delete [] estr[m];
     delete [] sstr[m];
   }
+
+  for (int m = 0; m < 6; m++) memory->destroy(wlist[m]);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -260,6 +268,14 @@ void FixWall::init()
 
   for (int m = 0; m < nwall; m++) precompute(m);
 
+  // candidate lists must be rebuilt every step if any wall position is
+  //   a variable or the group is dynamic
+  // else they are only rebuilt when neighbor lists are
+
+  listevery = 0;
+  if (xflag) listevery = 1;
+  if (group->dynamic[igroup]) listevery = 1;
+
   if (strstr(update->integrate_style,"respa")) {
     ilevel_respa = ((Respa *) update->integrate)->nlevels-1;
     if (respa_level >= 0) ilevel_respa = MIN(respa_level,ilevel_respa);
@@ -313,14 +329,14 @@ void FixWall::post_force(int vflag)
 
   if (varflag) modify->clearstep_compute();
 
-  double coord;
+  double coords[6];
   for (int m = 0; m < nwall; m++) {
     if (xstyle[m] == VARIABLE) {
-      coord = input->variable->compute_equal(xindex[m]);
-      if (wallwhich[m] < YLO) coord *= xscale;
-      else if (wallwhich[m] < ZLO) coord *= yscale;
-      else coord *= zscale;
-    } else coord = coord0[m];
+      coords[m] = input->variable->compute_equal(xindex[m]);
+      if (wallwhich[m] < YLO) coords[m] *= xscale;
+      else if (wallwhich[m] < ZLO) coords[m] *= yscale;
+      else coords[m] *= zscale;
+    } else coords[m] = coord0[m];
     if (wstyle[m] == VARIABLE) {
       if (estyle[m] == VARIABLE) {
         epsilon[m] = input->variable->compute_equal(eindex[m]);
@@ -334,10 +350,51 @@ void FixWall::post_force(int vflag)
       }
       precompute(m);
     }
+  }
+
+  // rebuild near-wall candidate lists when neighbor lists are rebuilt
+  // each list = group atoms within cutoff + skin of current wall position
+  // the skin margin gives the lists the same staleness guarantee as the
+  //   pair neighbor lists, wall kernels re-test the bare cutoff per atom
+  // variable wall positions and dynamic groups get no margin:
+  //   their lists are rebuilt every step with the bare cutoff
+
+  if (listevery || neighbor->ago == 0 || wlist[0] == NULL) {
+    if (atom->nmax > maxwlist) {
+      maxwlist = atom->nmax;
+      for (int m = 0; m < nwall; m++) {
+        memory->destroy(wlist[m]);
+        memory->create(wlist[m],maxwlist,"wall:wlist");
+      }
+    }
+
+    double **x = atom->x;
+    int *mask = atom->mask;
+    int nlocal = atom->nlocal;
+    double skin;
+    if (listevery) skin = 0.0;
+    else skin = neighbor->skin;
 
-    wall_particle(m,wallwhich[m],coord);
+    for (int m = 0; m < nwall; m++) {
+      int dim = wallwhich[m] / 2;
+      int side = wallwhich[m] % 2;
+      double cut = cutoff[m] + skin;
+      int n = 0;
+      if (side == 0) {
+        for (int i = 0; i < nlocal; i++)
+          if ((mask[i] & groupbit) && x[i][dim] - coords[m] < cut)
+            wlist[m][n++] = i;
+      } else {
+        for (int i = 0; i < nlocal; i++)
+          if ((mask[i] & groupbit) && coords[m] - x[i][dim] < cut)
+            wlist[m][n++] = i;
+      }
+      nwlist[m] = n;
+    }
   }
 
+  for (int m = 0; m < nwall; m++) wall_particle(m,wallwhich[m],coords[m]);
+
   if (varflag) modify->addstep_compute(update->ntimestep + 1);
 }
 
@@ -55,6 +55,12 @@ class FixWall : public Fix {
   int eflag;                  // per-wall flag for energy summation
   int ilevel_respa;
   int fldflag;
+  int nwlist[6];              // # of atoms in near-wall candidate lists
+  int *wlist[6];              // candidate list per wall:
+                              //   group atoms within cutoff + skin of wall
+  int maxwlist;               // allocated length of candidate lists
+  int listevery;              // 1 = rebuild lists every step,
+                              //   0 = only when neighbor lists are rebuilt
 };
 
 }
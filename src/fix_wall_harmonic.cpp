@@ -36,13 +36,12 @@ FixWallHarmonic::FixWallHarmonic(LAMMPS *lmp, int narg, char **arg) :
 
 void FixWallHarmonic::wall_particle(int m, int which, double coord)
 {
+  int i,ii;
   double delta,dr,fwall;
   double vn;
 
   double **x = atom->x;
   double **f = atom->f;
-  int *mask = atom->mask;
-  int nlocal = atom->nlocal;
 
   int dim = which / 2;
   int side = which % 2;
@@ -50,27 +49,29 @@ void FixWallHarmonic::wall_particle(int m, int which, double coord)
 
   int onflag = 0;
 
-  for (int i = 0; i < nlocal; i++)
-    if (mask[i] & groupbit) {
-      if (side < 0) delta = x[i][dim] - coord;
-      else delta = coord - x[i][dim];
-      if (delta >= cutoff[m]) continue;
-      if (delta <= 0.0) {
-        onflag = 1;
-        continue;
-      }
-      dr = cutoff[m]-delta;
-      fwall = side * 2.0*epsilon[m]*dr;
-      f[i][dim] -= fwall;
-      ewall[0] += epsilon[m]*dr*dr;
-      ewall[m+1] += fwall;
+  // loop over base-class candidate list of atoms near this wall
 
-      if (evflag) {
-        if (side < 0) vn = -fwall*delta;
-        else vn = fwall*delta;
-        v_tally(dim, i, vn);
-      }
+  for (ii = 0; ii < nwlist[m]; ii++) {
+    i = wlist[m][ii];
+    if (side < 0) delta = x[i][dim] - coord;
+    else delta = coord - x[i][dim];
+    if (delta >= cutoff[m]) continue;
+    if (delta <= 0.0) {
+      onflag = 1;
+      continue;
     }
+    dr = cutoff[m]-delta;
+    fwall = side * 2.0*epsilon[m]*dr;
+    f[i][dim] -= fwall;
+    ewall[0] += epsilon[m]*dr*dr;
+    ewall[m+1] += fwall;
+
+    if (evflag) {
+      if (side < 0) vn = -fwall*delta;
+      else vn = fwall*delta;
+      v_tally(dim, i, vn);
+    }
+  }
 
   if (onflag) error->one(FLERR,"Particle on or inside fix wall surface");
 }
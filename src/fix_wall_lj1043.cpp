@@ -54,40 +54,41 @@ void FixWallLJ1043::precompute(int m)
 
 void FixWallLJ1043::wall_particle(int m, int which, double coord)
 {
+  int i,ii;
   double delta,rinv,r2inv,r4inv,r10inv,fwall;
   double vn;
 
   double **x = atom->x;
   double **f = atom->f;
-  int *mask = atom->mask;
-  int nlocal = atom->nlocal;
 
   int dim = which / 2;
   int side = which % 2;
   if (side == 0) side = -1;
 
-  for (int i = 0; i < nlocal; i++)
-    if (mask[i] & groupbit) {
-      if (side < 0) delta = x[i][dim] - coord;
-      else delta = coord - x[i][dim];
-      if (delta <= 0.0) continue;
-      if (delta > cutoff[m]) continue;
-      rinv = 1.0/delta;
-      r2inv = rinv*rinv;
-      r4inv = r2inv*r2inv;
-      r10inv = r4inv*r4inv*r2inv;
-
-      fwall = side * (coeff5[m]*r10inv*rinv - coeff6[m]*r4inv*rinv -
-        coeff7[m]*pow(delta+coeff4[m],-4.0));
-      f[i][dim] -= fwall;
-      ewall[0] += coeff1[m]*r10inv - coeff2[m]*r4inv -
-        coeff3[m]*pow(delta+coeff4[m],-3.0) - offset[m];
-      ewall[m+1] += fwall;
-
-      if (evflag) {
-        if (side < 0) vn = -fwall*delta;
-        else vn = fwall*delta;
-        v_tally(dim, i, vn);
-      }
+  // loop over base-class candidate list of atoms near this wall
+
+  for (ii = 0; ii < nwlist[m]; ii++) {
+    i = wlist[m][ii];
+    if (side < 0) delta = x[i][dim] - coord;
+    else delta = coord - x[i][dim];
+    if (delta <= 0.0) continue;
+    if (delta > cutoff[m]) continue;
+    rinv = 1.0/delta;
+    r2inv = rinv*rinv;
+    r4inv = r2inv*r2inv;
+    r10inv = r4inv*r4inv*r2inv;
+
+    fwall = side * (coeff5[m]*r10inv*rinv - coeff6[m]*r4inv*rinv -
+      coeff7[m]*pow(delta+coeff4[m],-4.0));
+    f[i][dim] -= fwall;
+    ewall[0] += coeff1[m]*r10inv - coeff2[m]*r4inv -
+      coeff3[m]*pow(delta+coeff4[m],-3.0) - offset[m];
+    ewall[m+1] += fwall;
+
+    if (evflag) {
+      if (side < 0) vn = -fwall*delta;
+      else vn = fwall*delta;
+      v_tally(dim, i, vn);
     }
+  }
 }
@@ -51,13 +51,12 @@ void FixWallLJ93::precompute(int m)
 
 void FixWallLJ93::wall_particle(int m, int which, double coord)
 {
+  int i,ii;
   double delta,rinv,r2inv,r4inv,r10inv,fwall;
   double vn;
 
   double **x = atom->x;
   double **f = atom->f;
-  int *mask = atom->mask;
-  int nlocal = atom->nlocal;
 
   int dim = which / 2;
   int side = which % 2;
@@ -65,31 +64,33 @@ void FixWallLJ93::wall_particle(int m, int which, double coord)
 
   int onflag = 0;
 
-  for (int i = 0; i < nlocal; i++)
-    if (mask[i] & groupbit) {
-      if (side < 0) delta = x[i][dim] - coord;
-      else delta = coord - x[i][dim];
-      if (delta >= cutoff[m]) continue;
-      if (delta <= 0.0) {
-        onflag = 1;
-        continue;
-      }
-      rinv = 1.0/delta;
-      r2inv = rinv*rinv;
-      r4inv = r2inv*r2inv;
-      r10inv = r4inv*r4inv*r2inv;
-      fwall = side * (coeff1[m]*r10inv - coeff2[m]*r4inv);
-      f[i][dim] -= fwall;
-      ewall[0] += coeff3[m]*r4inv*r4inv*rinv -
-        coeff4[m]*r2inv*rinv - offset[m];
-      ewall[m+1] += fwall;
-
-      if (evflag) {
-        if (side < 0) vn = -fwall*delta;
-        else vn = fwall*delta;
-        v_tally(dim, i, vn);
-      }
+  // loop over base-class candidate list of atoms near this wall
+
+  for (ii = 0; ii < nwlist[m]; ii++) {
+    i = wlist[m][ii];
+    if (side < 0) delta = x[i][dim] - coord;
+    else delta = coord - x[i][dim];
+    if (delta >= cutoff[m]) continue;
+    if (delta <= 0.0) {
+      onflag = 1;
+      continue;
+    }
+    rinv = 1.0/delta;
+    r2inv = rinv*rinv;
+    r4inv = r2inv*r2inv;
+    r10inv = r4inv*r4inv*r2inv;
+    fwall = side * (coeff1[m]*r10inv - coeff2[m]*r4inv);
+    f[i][dim] -= fwall;
+    ewall[0] += coeff3[m]*r4inv*r4inv*rinv -
+      coeff4[m]*r2inv*rinv - offset[m];
+    ewall[m+1] += fwall;
+
+    if (evflag) {
+      if (side < 0) vn = -fwall*delta;
+      else vn = fwall*delta;
+      v_tally(dim, i, vn);
     }
+  }
 
   if (onflag) error->one(FLERR,"Particle on or inside fix wall surface");
 }
@@ -283,17 +283,23 @@ void Image::clear()
       imageBuffer[iy * width * 3 + ix * 3 + 2] = blue;
       depthBuffer[iy * width + ix] = -1;
     }
+
+  dirtylo = height;
+  dirtyhi = 0;
 }
 
 /* ----------------------------------------------------------------------
    merge image from each processor into one composite image
    done pixel by pixel, respecting depth buffer
    hi procs send to lo procs, cascading down logarithmically
+   only the rows a sender has drawn are exchanged
+     since its other pixels have depth -1 and can never win the merge
 ------------------------------------------------------------------------- */
 
 void Image::merge()
 {
   MPI_Request requests[3];
+  int range[2];
 
   int nhalf = 1;
   while (nhalf < nprocs) nhalf *= 2;
@@ -301,32 +307,50 @@ void Image::merge()
 
   while (nhalf) {
     if (me < nhalf && me+nhalf < nprocs) {
-      MPI_Irecv(rgbcopy,npixels*3,MPI_BYTE,me+nhalf,0,world,&requests[0]);
-      MPI_Irecv(depthcopy,npixels,MPI_DOUBLE,me+nhalf,0,world,&requests[1]);
-      if (ssao)
-        MPI_Irecv(surfacecopy,npixels*2,MPI_DOUBLE,
-                  me+nhalf,0,world,&requests[2]);
-      if (ssao) MPI_Waitall(3,requests,MPI_STATUS_IGNORE);
-      else MPI_Waitall(2,requests,MPI_STATUS_IGNORE);
-
-      for (int i = 0; i < npixels; i++) {
-        if (depthBuffer[i] < 0 || (depthcopy[i] >= 0 &&
-                                   depthcopy[i] < depthBuffer[i])) {
-          depthBuffer[i] = depthcopy[i];
-          imageBuffer[i*3+0] = rgbcopy[i*3+0];
-          imageBuffer[i*3+1] = rgbcopy[i*3+1];
-          imageBuffer[i*3+2] = rgbcopy[i*3+2];
-          if (ssao) {
-            surfaceBuffer[i*2+0] = surfacecopy[i*2+0];
-            surfaceBuffer[i*2+1] = surfacecopy[i*2+1];
+      MPI_Recv(range,2,MPI_INT,me+nhalf,0,world,MPI_STATUS_IGNORE);
+      int nrecv = (range[1]-range[0]) * width;
+      if (nrecv) {
+        MPI_Irecv(rgbcopy,nrecv*3,MPI_BYTE,me+nhalf,0,world,&requests[0]);
+        MPI_Irecv(depthcopy,nrecv,MPI_DOUBLE,me+nhalf,0,world,&requests[1]);
+        if (ssao)
+          MPI_Irecv(surfacecopy,nrecv*2,MPI_DOUBLE,
+                    me+nhalf,0,world,&requests[2]);
+        if (ssao) MPI_Waitall(3,requests,MPI_STATUS_IGNORE);
+        else MPI_Waitall(2,requests,MPI_STATUS_IGNORE);
+
+        int first = range[0] * width;
+        for (int m = 0; m < nrecv; m++) {
+          int i = first + m;
+          if (depthBuffer[i] < 0 || (depthcopy[m] >= 0 &&
+                                     depthcopy[m] < depthBuffer[i])) {
+            depthBuffer[i] = depthcopy[m];
+            imageBuffer[i*3+0] = rgbcopy[m*3+0];
+            imageBuffer[i*3+1] = rgbcopy[m*3+1];
+            imageBuffer[i*3+2] = rgbcopy[m*3+2];
+            if (ssao) {
+              surfaceBuffer[i*2+0] = surfacecopy[m*2+0];
+              surfaceBuffer[i*2+1] = surfacecopy[m*2+1];
+            }
           }
         }
+
+        dirtylo = MIN(dirtylo,range[0]);
+        dirtyhi = MAX(dirtyhi,range[1]);
       }
 
     } else if (me >= nhalf && me < 2*nhalf) {
-      MPI_Send(imageBuffer,npixels*3,MPI_BYTE,me-nhalf,0,world);
-      MPI_Send(depthBuffer,npixels,MPI_DOUBLE,me-nhalf,0,world);
-      if (ssao) MPI_Send(surfaceBuffer,npixels*2,MPI_DOUBLE,me-nhalf,0,world);
+      range[0] = dirtylo;
+      range[1] = dirtyhi;
+      if (range[1] <= range[0]) range[0] = range[1] = 0;
+      MPI_Send(range,2,MPI_INT,me-nhalf,0,world);
+      int nsend = (range[1]-range[0]) * width;
+      if (nsend) {
+        int first = range[0] * width;
+        MPI_Send(&imageBuffer[first*3],nsend*3,MPI_BYTE,me-nhalf,0,world);
+        MPI_Send(&depthBuffer[first],nsend,MPI_DOUBLE,me-nhalf,0,world);
+        if (ssao)
+          MPI_Send(&surfaceBuffer[first*2],nsend*2,MPI_DOUBLE,me-nhalf,0,world);
+      }
     }
 
     nhalf /= 2;
@@ -826,6 +850,9 @@ void Image::draw_pixel(int ix, int iy, double depth,
                     depth >= depthBuffer[ix + iy*width])) return;
   depthBuffer[ix + iy*width] = depth;
 
+  if (iy < dirtylo) dirtylo = iy;
+  if (iy >= dirtyhi) dirtyhi = iy + 1;
+
   // store only the tangent relative to the camera normal (0,0,-1)
 
   surfaceBuffer[0 + ix * 2 + iy*width * 2] = surface[1];
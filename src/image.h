@@ -66,6 +66,7 @@ class Image : protected Pointers {
  private:
   int me,nprocs;
   int npixels;
+  int dirtylo,dirtyhi;          // range of image rows this proc has drawn
 
   class ColorMap **maps;
   int nmap;
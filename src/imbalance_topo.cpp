@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include "imbalance_topo.h"
+#include "atom.h"
+#include "comm.h"
+#include "force.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* -------------------------------------------------------------------- */
+
+ImbalanceTopo::ImbalanceTopo(LAMMPS *lmp) : Imbalance(lmp)
+{
+  did_warn = 0;
+}
+
+/* -------------------------------------------------------------------- */
+
+int ImbalanceTopo::options(int narg, char **arg)
+{
+  if (narg < 1) error->all(FLERR,"Illegal balance weight command");
+  factor = force->numeric(FLERR,arg[0]);
+  if (factor <= 0.0) error->all(FLERR,"Illegal balance weight command");
+  return 1;
+}
+
+/* -------------------------------------------------------------------- */
+
+void ImbalanceTopo::compute(double *weight)
+{
+  // only works for atom styles that store per-atom topology lists
+  // template systems (molecular = 2) keep topology in the molecule
+  // class, with no per-atom counts to weight by
+
+  if (atom->molecular != 1) {
+    if (comm->me == 0 && !did_warn)
+      error->warning(FLERR,
+                     "Balance weight topo skipped b/c atom style has "
+                     "no bond topology");
+    did_warn = 1;
+    return;
+  }
+
+  // weight = 1 + factor * # of bonded terms stored with each atom
+  // factor = cost of computing one bonded term relative to the cost
+  //   an unweighted atom already carries
+  // with newton bond on, each term is stored with only one of its
+  //   atoms; this still balances the total bonded work per proc,
+  //   which is what matters
+
+  int *num_bond = atom->num_bond;
+  int *num_angle = atom->num_angle;
+  int *num_dihedral = atom->num_dihedral;
+  int *num_improper = atom->num_improper;
+  int nlocal = atom->nlocal;
+
+  int ntopo;
+  for (int i = 0; i < nlocal; i++) {
+    ntopo = 0;
+    if (num_bond) ntopo += num_bond[i];
+    if (num_angle) ntopo += num_angle[i];
+    if (num_dihedral) ntopo += num_dihedral[i];
+    if (num_improper) ntopo += num_improper[i];
+    weight[i] *= 1.0 + factor*ntopo;
+  }
+}
+
+/* -------------------------------------------------------------------- */
+
+void ImbalanceTopo::info(FILE *fp)
+{
+  fprintf(fp,"  topo weight factor: %g\n",factor);
+}
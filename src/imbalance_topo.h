@@ -0,0 +1,53 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifndef LMP_IMBALANCE_TOPO_H
+#define LMP_IMBALANCE_TOPO_H
+
+#include "imbalance.h"
+
+namespace LAMMPS_NS {
+
+class ImbalanceTopo : public Imbalance {
+ public:
+  ImbalanceTopo(class LAMMPS *);
+  virtual ~ImbalanceTopo() {}
+
+ public:
+  // parse options, return number of arguments consumed
+  virtual int options(int, char **);
+  // compute and apply weight factors to local atom array
+  virtual void compute(double *);
+  // print information about the state of this imbalance compute
+  virtual void info(FILE *);
+
+ private:
+  double factor;               // cost of one bonded term re one atom
+  int did_warn;                // 1 if warned about missing topology
+};
+
+}
+
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+UNDOCUMENTED
+
+W: Balance weight topo skipped b/c atom style has no bond topology
+
+UNDOCUMENTED
+
+*/
@@ -41,6 +41,7 @@
 #include "universe.h"
 #include "variable.h"
 #include "update.h"
+#include "memory.h"
 #include "error.h"
 
 #include <ctime>
@@ -343,6 +344,10 @@ void Info::command(int narg, char **arg)
     double mbytes = bytes/1024.0/1024.0;
     fprintf(out,"Total dynamically allocated memory: %.4g Mbyte\n",mbytes);
 
+    // per-tag live/peak table, only when package memtrack is on
+
+    memory->tracking_report(out);
+
 #if defined(_WIN32)
     HANDLE phandle = GetCurrentProcess();
     PROCESS_MEMORY_COUNTERS_EX pmc;
@@ -348,14 +348,14 @@ void Input::parse()
       break;
     }
     if (quoteflag == 0) {
-      if (strstr(ptr,"\"\"\"") == ptr) {
+      if (ptr[0] == '"' && ptr[1] == '"' && ptr[2] == '"') {
         quoteflag = 3;
         ptr += 2;
       }
       else if (*ptr == '"') quoteflag = 2;
       else if (*ptr == '\'') quoteflag = 1;
     } else {
-      if (quoteflag == 3 && strstr(ptr,"\"\"\"") == ptr) {
+      if (quoteflag == 3 && ptr[0] == '"' && ptr[1] == '"' && ptr[2] == '"') {
         quoteflag = 0;
         ptr += 2;
       }
@@ -472,6 +472,12 @@ void Input::substitute(char *&str, char *&str2, int &max, int &max2, int flag)
   int quoteflag = 0;
   char *ptr = str;
 
+  // without a $ character nothing below can fire
+  // skip the char-by-char scan and copy-back
+  // matters for scripts that loop via jump/next over many plain lines
+
+  if (strchr(str,'$') == NULL) return;
+
   n = strlen(str) + 1;
   if (n > max2) reallocate(str2,max2,n);
   *str2 = '\0';
@@ -568,7 +574,7 @@ void Input::substitute(char *&str, char *&str2, int &max, int &max2, int flag)
     // copy 2 extra triple quote chars into str2
 
     if (quoteflag == 0) {
-      if (strstr(ptr,"\"\"\"") == ptr) {
+      if (ptr[0] == '"' && ptr[1] == '"' && ptr[2] == '"') {
         quoteflag = 3;
         *ptr2++ = *ptr++;
         *ptr2++ = *ptr++;
@@ -576,7 +582,7 @@ void Input::substitute(char *&str, char *&str2, int &max, int &max2, int flag)
       else if (*ptr == '"') quoteflag = 2;
       else if (*ptr == '\'') quoteflag = 1;
     } else {
-      if (quoteflag == 3 && strstr(ptr,"\"\"\"") == ptr) {
+      if (quoteflag == 3 && ptr[0] == '"' && ptr[1] == '"' && ptr[2] == '"') {
         quoteflag = 0;
         *ptr2++ = *ptr++;
         *ptr2++ = *ptr++;
@@ -1480,6 +1486,11 @@ void Input::comm_modify()
 
 void Input::comm_style()
 {
+  // switching styles between runs is safe: the conversion constructor
+  // copies user settings and all per-run comm state is rebuilt in setup.
+  // switching mid-run is not: buffer sizes and swap plans in comm,
+  // neighbor, and fixes all assume the pattern chosen at setup time
+
   if (narg < 1) error->all(FLERR,"Illegal comm_style command");
   if (strcmp(arg[0],"brick") == 0) {
     if (comm->style == 0) return;
@@ -1774,6 +1785,18 @@ void Input::package()
     modify->add_fix(2+narg,fixarg);
     delete [] fixarg;
 
+  } else if (strcmp(arg[0],"arena") == 0) {
+    if (narg != 2) error->all(FLERR,"Illegal package command");
+    bigint slabmb = force->bnumeric(FLERR,arg[1]);
+    if (slabmb < 0) error->all(FLERR,"Illegal package command");
+    memory->set_arena(slabmb*1024*1024);
+
+  } else if (strcmp(arg[0],"memtrack") == 0) {
+    if (narg != 2) error->all(FLERR,"Illegal package command");
+    if (strcmp(arg[1],"on") == 0) memory->set_tracking(1);
+    else if (strcmp(arg[1],"off") == 0) memory->set_tracking(0);
+    else error->all(FLERR,"Illegal package command");
+
   } else error->all(FLERR,"Illegal package command");
 }
 
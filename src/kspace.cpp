@@ -47,6 +47,9 @@ KSpace::KSpace(LAMMPS *lmp, int /*narg*/, char **/*arg*/) : Pointers(lmp)
   gewaldflag = 0;
   minorder = 2;
   overlap_allowed = 1;
+  pipeline_flag = 0;
+  pipeline_capable = 0;
+  pipeline_active = 0;
   fftbench = 0;
 
   // default to using MPI collectives for FFT/remap only on IBM BlueGene
@@ -475,6 +478,12 @@ void KSpace::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) overlap_allowed = 0;
       else error->all(FLERR,"Illegal kspace_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"pipeline") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) pipeline_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) pipeline_flag = 0;
+      else error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"force") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
       accuracy_absolute = force->numeric(FLERR,arg[iarg+1]);
@@ -53,6 +53,10 @@ class KSpace : protected Pointers {
   int scalar_pressure_flag;      // 1 if using MSM fast scalar pressure
   double slab_volfactor;
 
+  int pipeline_flag;             // 1 if user requested concurrent kspace/pair
+  int pipeline_capable;          // 1 if style can redirect its force output
+  int pipeline_active;           // 1 while integrator runs compute() pipelined
+
   int warn_nonneutral;           // 0 = error if non-neutral system
                                  // 1 = warn once if non-neutral system
                                  // 2 = warn, but already warned
@@ -116,6 +120,8 @@ class KSpace : protected Pointers {
   virtual void setup() = 0;
   virtual void setup_grid() {};
   virtual void compute(int, int) = 0;
+  virtual void pipeline_prepare() {}
+  virtual void pipeline_merge() {}
   virtual void compute_group_group(int, int, int) {};
 
   virtual void pack_forward(int, FFT_SCALAR *, int, int *) {};
@@ -30,11 +30,68 @@
 #define LAMMPS_MEMALIGN 64
 #endif
 
+#include <map>
+#include <string>
+#include <vector>
+
 using namespace LAMMPS_NS;
 
+// bookkeeping for the optional allocation-tracking mode
+// every allocation records its size and the tag portion of the name
+//   that each create/grow call already passes (the "class:" prefix),
+//   so live and peak bytes can be attributed per subsystem
+
+struct Memory::Tracker {
+  struct Tag {
+    std::string name;
+    bigint live,peak;
+  };
+  std::map<void *,std::pair<bigint,int> > blocks;  // ptr -> bytes, tag index
+  std::vector<Tag> tags;
+  bigint live,peak;
+
+  Tracker() : live(0), peak(0) {}
+
+  int findtag(const char *name) {
+    const char *colon = strchr(name,':');
+    std::string t = colon ? std::string(name,colon-name) : std::string(name);
+    for (int i = 0; i < (int) tags.size(); i++)
+      if (tags[i].name == t) return i;
+    Tag tag;
+    tag.name = t;
+    tag.live = tag.peak = 0;
+    tags.push_back(tag);
+    return (int) tags.size() - 1;
+  }
+};
+
+// arena blocks carry a hidden header storing their size
+// header is one alignment unit so user pointers stay aligned
+
+#if defined(LAMMPS_MEMALIGN)
+#define ARENA_ALIGN LAMMPS_MEMALIGN
+#else
+#define ARENA_ALIGN 64
+#endif
+
 /* ---------------------------------------------------------------------- */
 
-Memory::Memory(LAMMPS *lmp) : Pointers(lmp) {}
+Memory::Memory(LAMMPS *lmp) : Pointers(lmp)
+{
+  slabs = NULL;
+  nslab = maxslab = 0;
+  slabsize = 0;
+  tracker = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+Memory::~Memory()
+{
+  for (int i = 0; i < nslab; i++) free(slabs[i].base);
+  free(slabs);
+  delete tracker;
+}
 
 /* ----------------------------------------------------------------------
    safe malloc
@@ -44,6 +101,17 @@ void *Memory::smalloc(bigint nbytes, const char *name)
 {
   if (nbytes == 0) return NULL;
 
+  // service small requests from the arena when enabled
+  // oversized requests fall through to the system allocator
+
+  if (slabsize && nbytes <= slabsize/2) {
+    void *aptr = arena_alloc(nbytes);
+    if (aptr) {
+      if (tracker) track_alloc(aptr,nbytes,name);
+      return aptr;
+    }
+  }
+
 #if defined(LAMMPS_MEMALIGN)
   void *ptr;
 
@@ -63,6 +131,7 @@ void *Memory::smalloc(bigint nbytes, const char *name)
             nbytes,name);
     error->one(FLERR,str);
   }
+  if (tracker) track_alloc(ptr,nbytes,name);
   return ptr;
 }
 
@@ -77,6 +146,22 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
     return NULL;
   }
 
+  // arena blocks cannot be realloced in place
+  // copy into a fresh block and release the old one
+
+  if (nslab) {
+    int islab = arena_find(ptr);
+    if (islab >= 0) {
+      bigint oldbytes = *((bigint *) ((char *) ptr - ARENA_ALIGN));
+      void *newptr = smalloc(nbytes,name);
+      memcpy(newptr,ptr,MIN(nbytes,oldbytes));
+      sfree(ptr);
+      return newptr;
+    }
+  }
+
+  if (tracker) track_free(ptr);
+
 #if defined(LMP_USE_TBB_ALLOCATOR)
   ptr = scalable_aligned_realloc(ptr, nbytes, LAMMPS_MEMALIGN);
 #elif defined(LMP_INTEL_NO_TBB) && defined(LAMMPS_MEMALIGN)
@@ -97,6 +182,7 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
             nbytes,name);
     error->one(FLERR,str);
   }
+  if (tracker) track_alloc(ptr,nbytes,name);
   return ptr;
 }
 
@@ -107,6 +193,21 @@ void *Memory::srealloc(void *ptr, bigint nbytes, const char *name)
 void Memory::sfree(void *ptr)
 {
   if (ptr == NULL) return;
+
+  if (tracker) track_free(ptr);
+
+  // arena blocks are not freed individually
+  // a slab rewinds in bulk once its last block is released
+
+  if (nslab) {
+    int islab = arena_find(ptr);
+    if (islab >= 0) {
+      slabs[islab].nalloc--;
+      if (slabs[islab].nalloc == 0) slabs[islab].offset = 0;
+      return;
+    }
+  }
+
   #if defined(LMP_USE_TBB_ALLOCATOR)
   scalable_aligned_free(ptr);
   #else
@@ -114,6 +215,160 @@ void Memory::sfree(void *ptr)
   #endif
 }
 
+/* ----------------------------------------------------------------------
+   enable/disable the slab arena, n = bytes per slab, 0 = disabled
+   invoked by package arena command
+   slabs with live blocks are kept so their blocks can still be released
+------------------------------------------------------------------------- */
+
+void Memory::set_arena(bigint n)
+{
+  slabsize = n;
+
+  int m = 0;
+  for (int i = 0; i < nslab; i++) {
+    if (slabs[i].nalloc == 0) free(slabs[i].base);
+    else slabs[m++] = slabs[i];
+  }
+  nslab = m;
+}
+
+/* ----------------------------------------------------------------------
+   enable/disable allocation tracking, invoked by package memtrack command
+   peak watermarks only cover allocations made while tracking is on
+------------------------------------------------------------------------- */
+
+void Memory::set_tracking(int flag)
+{
+  if (flag && !tracker) tracker = new Tracker();
+  else if (!flag && tracker) {
+    delete tracker;
+    tracker = NULL;
+  }
+}
+
+/* ----------------------------------------------------------------------
+   record one allocation under the tag prefix of its name
+   an already-recorded ptr is released first, so re-use is safe
+------------------------------------------------------------------------- */
+
+void Memory::track_alloc(void *ptr, bigint nbytes, const char *name)
+{
+  if (ptr == NULL) return;
+  track_free(ptr);
+
+  int itag = tracker->findtag(name);
+  tracker->blocks[ptr] = std::make_pair(nbytes,itag);
+  tracker->tags[itag].live += nbytes;
+  tracker->tags[itag].peak = MAX(tracker->tags[itag].peak,
+                                 tracker->tags[itag].live);
+  tracker->live += nbytes;
+  tracker->peak = MAX(tracker->peak,tracker->live);
+}
+
+/* ----------------------------------------------------------------------
+   forget one allocation
+   ptrs allocated before tracking was enabled are silently skipped
+------------------------------------------------------------------------- */
+
+void Memory::track_free(void *ptr)
+{
+  std::map<void *,std::pair<bigint,int> >::iterator it =
+    tracker->blocks.find(ptr);
+  if (it == tracker->blocks.end()) return;
+
+  tracker->tags[it->second.second].live -= it->second.first;
+  tracker->live -= it->second.first;
+  tracker->blocks.erase(it);
+}
+
+/* ----------------------------------------------------------------------
+   print live and peak tracked bytes per tag, largest peak first
+   invoked by the info memory command, no-op while tracking is off
+------------------------------------------------------------------------- */
+
+void Memory::tracking_report(FILE *fp)
+{
+  if (fp == NULL || tracker == NULL) return;
+
+  int ntag = (int) tracker->tags.size();
+  std::vector<int> order(ntag);
+  for (int i = 0; i < ntag; i++) order[i] = i;
+  for (int i = 0; i < ntag-1; i++) {
+    int big = i;
+    for (int j = i+1; j < ntag; j++)
+      if (tracker->tags[order[j]].peak > tracker->tags[order[big]].peak)
+        big = j;
+    int tmp = order[i]; order[i] = order[big]; order[big] = tmp;
+  }
+
+  const double mb = 1.0/1024.0/1024.0;
+  fprintf(fp,"\nTracked allocations by subsystem:\n");
+  fprintf(fp,"%-24s %12s %12s\n","tag","live Mbyte","peak Mbyte");
+  for (int i = 0; i < ntag; i++) {
+    Tracker::Tag &tag = tracker->tags[order[i]];
+    fprintf(fp,"%-24s %12.4g %12.4g\n",
+            tag.name.c_str(),mb*tag.live,mb*tag.peak);
+  }
+  fprintf(fp,"%-24s %12.4g %12.4g\n","total",
+          mb*tracker->live,mb*tracker->peak);
+}
+
+/* ----------------------------------------------------------------------
+   bump-allocate nbytes from an arena slab, pre-faulting new slabs
+   return NULL if the request cannot be serviced
+------------------------------------------------------------------------- */
+
+void *Memory::arena_alloc(bigint nbytes)
+{
+  bigint needed = ARENA_ALIGN +
+    ((nbytes + ARENA_ALIGN - 1) / ARENA_ALIGN) * ARENA_ALIGN;
+
+  int islab;
+  for (islab = 0; islab < nslab; islab++)
+    if (slabs[islab].size >= slabs[islab].offset + needed) break;
+
+  if (islab == nslab) {
+    if (nslab == maxslab) {
+      maxslab += 8;
+      slabs = (Slab *) realloc(slabs,maxslab*sizeof(Slab));
+      if (slabs == NULL) return NULL;
+    }
+    void *base;
+#if defined(LAMMPS_MEMALIGN)
+    if (posix_memalign(&base,LAMMPS_MEMALIGN,slabsize)) return NULL;
+#else
+    base = malloc(slabsize);
+    if (base == NULL) return NULL;
+#endif
+    memset(base,0,slabsize);
+    slabs[nslab].base = (char *) base;
+    slabs[nslab].size = slabsize;
+    slabs[nslab].offset = 0;
+    slabs[nslab].nalloc = 0;
+    nslab++;
+  }
+
+  char *block = slabs[islab].base + slabs[islab].offset;
+  *((bigint *) block) = nbytes;
+  slabs[islab].offset += needed;
+  slabs[islab].nalloc++;
+  return block + ARENA_ALIGN;
+}
+
+/* ----------------------------------------------------------------------
+   return index of slab containing ptr, -1 if not an arena block
+------------------------------------------------------------------------- */
+
+int Memory::arena_find(void *ptr)
+{
+  char *cptr = (char *) ptr;
+  for (int i = 0; i < nslab; i++)
+    if (cptr >= slabs[i].base && cptr < slabs[i].base + slabs[i].size)
+      return i;
+  return -1;
+}
+
 /* ----------------------------------------------------------------------
    erroneous usage of templated create/grow functions
 ------------------------------------------------------------------------- */
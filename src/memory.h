@@ -22,11 +22,15 @@ namespace LAMMPS_NS {
 class Memory : protected Pointers {
  public:
   Memory(class LAMMPS *);
+  ~Memory();
 
   void *smalloc(bigint n, const char *);
   void *srealloc(void *, bigint n, const char *);
   void sfree(void *);
   void fail(const char *);
+  void set_arena(bigint n);
+  void set_tracking(int);
+  void tracking_report(FILE *);
 
 /* ----------------------------------------------------------------------
    create/grow/destroy vecs and multidim arrays with contiguous memory blocks
@@ -607,6 +611,27 @@ class Memory : protected Pointers {
     bytes += ((bigint) sizeof(TYPE ***)) * n1;
     return bytes;
   }
+
+ private:
+  struct Slab {                 // one pre-faulted arena slab
+    char *base;                 // start of slab memory
+    bigint size;                // total bytes in slab
+    bigint offset;              // bump pointer, bytes already handed out
+    int nalloc;                 // # of live blocks, slab resets when 0
+  };
+
+  Slab *slabs;                  // list of arena slabs
+  int nslab;                    // # of slabs allocated
+  int maxslab;                  // max # of slabs list can hold
+  bigint slabsize;              // bytes per slab, 0 = arena disabled
+
+  struct Tracker;               // allocation bookkeeping, see memory.cpp
+  Tracker *tracker;             // NULL when tracking is off
+
+  void *arena_alloc(bigint);
+  int arena_find(void *);
+  void track_alloc(void *, bigint, const char *);
+  void track_free(void *);
 };
 
 }
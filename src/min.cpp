@@ -267,6 +267,13 @@ void Min::setup(int flag)
       error->all(FLERR, "Cannot use hftn min style with per-atom DOF");
   }
 
+  if (strcmp(update->minimize_style,"lbfgs") == 0) {
+    if (nextra_global)
+      error->all(FLERR, "Cannot use lbfgs min style with fix box/relax");
+    if (nextra_atom)
+      error->all(FLERR, "Cannot use lbfgs min style with per-atom DOF");
+  }
+
   // atoms may have migrated in comm->exchange()
 
   reset_vectors();
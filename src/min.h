@@ -143,6 +143,14 @@ E: Cannot use hftn min style with per-atom DOF
 
 UNDOCUMENTED
 
+E: Cannot use lbfgs min style with fix box/relax
+
+UNDOCUMENTED
+
+E: Cannot use lbfgs min style with per-atom DOF
+
+UNDOCUMENTED
+
 E: Illegal ... command
 
 Self-explanatory.  Check the input script syntax and compare to the
@@ -0,0 +1,206 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+/* ----------------------------------------------------------------------
+   Sources: Nocedal and Wright, Numerical Optimization, chapter on
+            limited-memory quasi-Newton methods (two-loop recursion)
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <cmath>
+#include "min_lbfgs.h"
+#include "atom.h"
+#include "update.h"
+#include "output.h"
+#include "timer.h"
+#include "modify.h"
+#include "fix_minimize.h"
+
+using namespace LAMMPS_NS;
+
+// EPS_ENERGY = minimum normalization for energy tolerance
+
+#define EPS_ENERGY 1.0e-8
+
+/* ---------------------------------------------------------------------- */
+
+MinLBFGS::MinLBFGS(LAMMPS *lmp) : MinLineSearch(lmp) {}
+
+/* ---------------------------------------------------------------------- */
+
+void MinLBFGS::setup_style()
+{
+  MinLineSearch::setup_style();
+
+  // memory for s,y curvature pairs for atomic dof
+  // extra global and per-atom dof are disallowed in Min::setup()
+
+  for (int k = 0; k < MAXPAIR; k++) {
+    fix_minimize->add_vector(3);
+    fix_minimize->add_vector(3);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   set current vector lengths and pointers
+   called after atoms have migrated
+------------------------------------------------------------------------- */
+
+void MinLBFGS::reset_vectors()
+{
+  MinLineSearch::reset_vectors();
+
+  int n = 3;
+  if (nextra_atom) n += 3*nextra_atom;
+  for (int k = 0; k < MAXPAIR; k++) {
+    s[k] = fix_minimize->request_vector(n++);
+    y[k] = fix_minimize->request_vector(n++);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   minimization via limited-memory BFGS iterations
+   stores up to MAXPAIR curvature pairs from previous linesearch steps
+     and applies them to the current force via the two-loop recursion,
+     so each iteration reuses an approximate inverse Hessian instead of
+     discarding curvature info as CG does
+------------------------------------------------------------------------- */
+
+int MinLBFGS::iterate(int maxiter)
+{
+  int i,k,kk,fail,ntimestep;
+  double beta,si,yi,dot[2],dotall[2];
+
+  // initial search direction = steepest descent, no stored pairs
+
+  npair = 0;
+  iring = 0;
+  gamma = 1.0;
+
+  for (i = 0; i < nvec; i++) h[i] = fvec[i];
+
+  for (int iter = 0; iter < maxiter; iter++) {
+
+    if (timer->check_timeout(niter))
+      return TIMEOUT;
+
+    ntimestep = ++update->ntimestep;
+    niter++;
+
+    // save force at start of linesearch, linemin saves the coords in x0
+
+    for (i = 0; i < nvec; i++) g[i] = fvec[i];
+
+    // line minimization along direction h from current atom->x
+
+    eprevious = ecurrent;
+    fail = (this->*linemin)(ecurrent,alpha_final);
+    if (fail) return fail;
+
+    // function evaluation criterion
+
+    if (neval >= update->max_eval) return MAXEVAL;
+
+    // energy tolerance criterion
+
+    if (fabs(ecurrent-eprevious) <
+        update->etol * 0.5*(fabs(ecurrent) + fabs(eprevious) + EPS_ENERGY))
+      return ETOL;
+
+    // force tolerance criterion
+
+    dot[0] = 0.0;
+    for (i = 0; i < nvec; i++) dot[0] += fvec[i]*fvec[i];
+    MPI_Allreduce(dot,dotall,1,MPI_DOUBLE,MPI_SUM,world);
+
+    if (dotall[0] < update->ftol*update->ftol) return FTOL;
+
+    // trial curvature pair from the linesearch step
+    // s = x - x0, y = grad difference = g - f
+    // store it in the ring buffer only if curvature y dot s is
+    //   positive, which keeps the implicit inverse Hessian positive
+    //   definite; test before storing since a rejected pair would
+    //   otherwise overwrite a slot the recursion below still reads
+    //   with s,y that do not match its stored rho when the ring is full
+
+    dot[0] = dot[1] = 0.0;
+    for (i = 0; i < nvec; i++) {
+      si = xvec[i] - x0[i];
+      yi = g[i] - fvec[i];
+      dot[0] += yi*si;
+      dot[1] += yi*yi;
+    }
+    MPI_Allreduce(dot,dotall,2,MPI_DOUBLE,MPI_SUM,world);
+
+    if (dotall[0] > 0.0) {
+      k = iring;
+      for (i = 0; i < nvec; i++) {
+        s[k][i] = xvec[i] - x0[i];
+        y[k][i] = g[i] - fvec[i];
+      }
+      rho[k] = 1.0/dotall[0];
+      gamma = dotall[0]/dotall[1];
+      iring = (iring+1) % MAXPAIR;
+      if (npair < MAXPAIR) npair++;
+    }
+
+    // new search direction h = H f from the two-loop recursion
+    // applies the stored pairs, newest to oldest then back, to the
+    //   current force with the scaled identity gamma*I as initial H
+
+    for (i = 0; i < nvec; i++) h[i] = fvec[i];
+
+    for (kk = 0; kk < npair; kk++) {
+      k = (iring-1-kk+MAXPAIR) % MAXPAIR;
+      dot[0] = 0.0;
+      for (i = 0; i < nvec; i++) dot[0] += s[k][i]*h[i];
+      MPI_Allreduce(dot,dotall,1,MPI_DOUBLE,MPI_SUM,world);
+      alpha[k] = rho[k]*dotall[0];
+      for (i = 0; i < nvec; i++) h[i] -= alpha[k]*y[k][i];
+    }
+
+    for (i = 0; i < nvec; i++) h[i] *= gamma;
+
+    for (kk = npair-1; kk >= 0; kk--) {
+      k = (iring-1-kk+MAXPAIR) % MAXPAIR;
+      dot[0] = 0.0;
+      for (i = 0; i < nvec; i++) dot[0] += y[k][i]*h[i];
+      MPI_Allreduce(dot,dotall,1,MPI_DOUBLE,MPI_SUM,world);
+      beta = rho[k]*dotall[0];
+      for (i = 0; i < nvec; i++) h[i] += (alpha[k]-beta)*s[k][i];
+    }
+
+    // discard stored pairs and restart from steepest descent
+    //   if new search direction h is not downhill
+
+    dot[0] = 0.0;
+    for (i = 0; i < nvec; i++) dot[0] += h[i]*fvec[i];
+    MPI_Allreduce(dot,dotall,1,MPI_DOUBLE,MPI_SUM,world);
+
+    if (dotall[0] <= 0.0) {
+      npair = 0;
+      gamma = 1.0;
+      for (i = 0; i < nvec; i++) h[i] = fvec[i];
+    }
+
+    // output for thermo, dump, restart files
+
+    if (output->next == ntimestep) {
+      timer->stamp();
+      output->write(ntimestep);
+      timer->stamp(Timer::OUTPUT);
+    }
+  }
+
+  return MAXITER;
+}
@@ -0,0 +1,51 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef MINIMIZE_CLASS
+
+MinimizeStyle(lbfgs,MinLBFGS)
+
+#else
+
+#ifndef LMP_MIN_LBFGS_H
+#define LMP_MIN_LBFGS_H
+
+#include "min_linesearch.h"
+
+namespace LAMMPS_NS {
+
+class MinLBFGS : public MinLineSearch {
+ public:
+  MinLBFGS(class LAMMPS *);
+  void setup_style();
+  void reset_vectors();
+  int iterate(int);
+
+ private:
+  // MAXPAIR = max # of stored curvature pairs
+
+  enum {MAXPAIR = 8};
+
+  double *s[MAXPAIR];       // position differences x_k+1 - x_k
+  double *y[MAXPAIR];       // gradient differences grad_k+1 - grad_k
+  double rho[MAXPAIR];      // 1 / (y_k dot s_k)
+  double alpha[MAXPAIR];    // scratch for two-loop recursion
+  double gamma;             // scaling of initial inverse Hessian
+  int npair;                // # of pairs currently stored
+  int iring;                // ring buffer slot for next pair
+};
+
+}
+
+#endif
+#endif
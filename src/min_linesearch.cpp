@@ -843,30 +843,35 @@ double MinLineSearch::alpha_step(double alpha, int resetflag)
   int i,n,m;
   double *xatom,*x0atom,*hatom;
 
-  // reset to starting point
-
-  if (nextra_global) modify->min_step(0.0,hextra);
-  for (i = 0; i < nvec; i++) xvec[i] = x0[i];
-  if (nextra_atom)
-    for (m = 0; m < nextra_atom; m++) {
-      xatom = xextra_atom[m];
-      x0atom = x0extra_atom[m];
-      n = extra_nlen[m];
-      for (i = 0; i < n; i++) xatom[i] = x0atom[i];
-      requestor[m]->min_x_set(m);
-    }
-
-  // step forward along h
+  // step from stored starting point along h in one pass
+  // x = x0 + alpha*h is a single loop the compiler can vectorize,
+  //   vs resetting to x0 and incrementing in two passes
+  // min_step() sets extra global dof from its own stored reference
 
   if (alpha > 0.0) {
     if (nextra_global) modify->min_step(alpha,hextra);
-    for (i = 0; i < nvec; i++) xvec[i] += alpha*h[i];
+    for (i = 0; i < nvec; i++) xvec[i] = x0[i] + alpha*h[i];
     if (nextra_atom)
       for (m = 0; m < nextra_atom; m++) {
         xatom = xextra_atom[m];
+        x0atom = x0extra_atom[m];
         hatom = hextra_atom[m];
         n = extra_nlen[m];
-        for (i = 0; i < n; i++) xatom[i] += alpha*hatom[i];
+        for (i = 0; i < n; i++) xatom[i] = x0atom[i] + alpha*hatom[i];
+        requestor[m]->min_x_set(m);
+      }
+
+  // reset to starting point
+
+  } else {
+    if (nextra_global) modify->min_step(0.0,hextra);
+    for (i = 0; i < nvec; i++) xvec[i] = x0[i];
+    if (nextra_atom)
+      for (m = 0; m < nextra_atom; m++) {
+        xatom = xextra_atom[m];
+        x0atom = x0extra_atom[m];
+        n = extra_nlen[m];
+        for (i = 0; i < n; i++) xatom[i] = x0atom[i];
         requestor[m]->min_x_set(m);
       }
   }
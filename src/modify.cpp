@@ -11,6 +11,7 @@
    See the README file in the top-level LAMMPS directory.
 ------------------------------------------------------------------------- */
 
+#include <mpi.h>
 #include <cstdio>
 #include <cstring>
 #include "modify.h"
@@ -22,6 +23,7 @@
 #include "compute.h"
 #include "group.h"
 #include "update.h"
+#include "timer.h"
 #include "domain.h"
 #include "region.h"
 #include "input.h"
@@ -166,6 +168,10 @@ void Modify::init()
   restart_deallocate(1);
 
   // create lists of fixes to call at each stage of run
+  // within each list, fixes are invoked serially in definition order
+  // this ordering is a documented contract relied on by input scripts,
+  //   and fixes may issue MPI collectives from any of these methods,
+  //   so the lists must not be reordered or dispatched concurrently
 
   list_init(INITIAL_INTEGRATE,n_initial_integrate,list_initial_integrate);
   list_init(POST_INTEGRATE,n_post_integrate,list_post_integrate);
@@ -287,6 +293,10 @@ void Modify::init()
 
 void Modify::setup(int vflag)
 {
+  // reset per-fix wall time accumulators, only filled in timer full mode
+
+  for (int i = 0; i < nfix; i++) fix[i]->walltime = 0.0;
+
   // compute setup needs to come before fix setup
   //   b/c NH fixes need DOF of temperature computes
   // fix group setup() is special case since populates a dynamic group
@@ -384,6 +394,16 @@ void Modify::setup_pre_reverse(int eflag, int vflag)
 
 void Modify::initial_integrate(int vflag)
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_initial_integrate; i++) {
+      t = MPI_Wtime();
+      fix[list_initial_integrate[i]]->initial_integrate(vflag);
+      fix[list_initial_integrate[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_initial_integrate; i++)
     fix[list_initial_integrate[i]]->initial_integrate(vflag);
 }
@@ -394,6 +414,16 @@ void Modify::initial_integrate(int vflag)
 
 void Modify::post_integrate()
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_post_integrate; i++) {
+      t = MPI_Wtime();
+      fix[list_post_integrate[i]]->post_integrate();
+      fix[list_post_integrate[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_post_integrate; i++)
     fix[list_post_integrate[i]]->post_integrate();
 }
@@ -404,6 +434,16 @@ void Modify::post_integrate()
 
 void Modify::pre_exchange()
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_pre_exchange; i++) {
+      t = MPI_Wtime();
+      fix[list_pre_exchange[i]]->pre_exchange();
+      fix[list_pre_exchange[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_pre_exchange; i++)
     fix[list_pre_exchange[i]]->pre_exchange();
 }
@@ -414,6 +454,16 @@ void Modify::pre_exchange()
 
 void Modify::pre_neighbor()
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_pre_neighbor; i++) {
+      t = MPI_Wtime();
+      fix[list_pre_neighbor[i]]->pre_neighbor();
+      fix[list_pre_neighbor[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_pre_neighbor; i++)
     fix[list_pre_neighbor[i]]->pre_neighbor();
 }
@@ -424,6 +474,16 @@ void Modify::pre_neighbor()
 
 void Modify::post_neighbor()
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_post_neighbor; i++) {
+      t = MPI_Wtime();
+      fix[list_post_neighbor[i]]->post_neighbor();
+      fix[list_post_neighbor[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_post_neighbor; i++)
     fix[list_post_neighbor[i]]->post_neighbor();
 }
@@ -434,6 +494,16 @@ void Modify::post_neighbor()
 
 void Modify::pre_force(int vflag)
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_pre_force; i++) {
+      t = MPI_Wtime();
+      fix[list_pre_force[i]]->pre_force(vflag);
+      fix[list_pre_force[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_pre_force; i++)
     fix[list_pre_force[i]]->pre_force(vflag);
 }
@@ -443,6 +513,16 @@ void Modify::pre_force(int vflag)
 
 void Modify::pre_reverse(int eflag, int vflag)
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_pre_reverse; i++) {
+      t = MPI_Wtime();
+      fix[list_pre_reverse[i]]->pre_reverse(eflag,vflag);
+      fix[list_pre_reverse[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_pre_reverse; i++)
     fix[list_pre_reverse[i]]->pre_reverse(eflag,vflag);
 }
@@ -453,6 +533,16 @@ void Modify::pre_reverse(int eflag, int vflag)
 
 void Modify::post_force(int vflag)
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_post_force; i++) {
+      t = MPI_Wtime();
+      fix[list_post_force[i]]->post_force(vflag);
+      fix[list_post_force[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_post_force; i++)
     fix[list_post_force[i]]->post_force(vflag);
 }
@@ -463,6 +553,16 @@ void Modify::post_force(int vflag)
 
 void Modify::final_integrate()
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_final_integrate; i++) {
+      t = MPI_Wtime();
+      fix[list_final_integrate[i]]->final_integrate();
+      fix[list_final_integrate[i]]->walltime += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_final_integrate; i++)
     fix[list_final_integrate[i]]->final_integrate();
 }
@@ -474,6 +574,17 @@ void Modify::final_integrate()
 
 void Modify::end_of_step()
 {
+  if (timer->has_full()) {
+    double t;
+    for (int i = 0; i < n_end_of_step; i++)
+      if (update->ntimestep % end_of_step_every[i] == 0) {
+        t = MPI_Wtime();
+        fix[list_end_of_step[i]]->end_of_step();
+        fix[list_end_of_step[i]]->walltime += MPI_Wtime() - t;
+      }
+    return;
+  }
+
   for (int i = 0; i < n_end_of_step; i++)
     if (update->ntimestep % end_of_step_every[i] == 0)
       fix[list_end_of_step[i]]->end_of_step();
@@ -31,6 +31,11 @@ NBin::NBin(LAMMPS *lmp) : Pointers(lmp)
   bins = NULL;
   atom2bin = NULL;
 
+  ncolor = nblock = 0;
+  colorblock = NULL;
+  blockstart = NULL;
+  blockbins = NULL;
+
   // geometry settings
 
   dimension = domain->dimension;
@@ -44,6 +49,9 @@ NBin::~NBin()
   memory->destroy(binhead);
   memory->destroy(bins);
   memory->destroy(atom2bin);
+  memory->destroy(colorblock);
+  memory->destroy(blockstart);
+  memory->destroy(blockbins);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -147,6 +155,79 @@ int NBin::coord2bin(double *x)
   return (iz-mbinzlo)*mbiny*mbinx + (iy-mbinylo)*mbinx + (ix-mbinxlo);
 }
 
+/* ----------------------------------------------------------------------
+   build the lock-free color partition for the current bin grid
+   block edge per dim = 2x the stencil extent in bins, so the
+     interaction halos of same-color blocks cannot overlap
+   a dim with a single block gets 1 color, else 2 by block parity
+   called from setup_bins() variants after the bin grid is set
+------------------------------------------------------------------------- */
+
+void NBin::build_color_partition()
+{
+  double cutoff = cutneighmax;
+  if (cutoff_custom > 0.0) cutoff = cutoff_custom;
+
+  // block edges in bins per dim
+
+  int bex = 2 * (static_cast<int> (cutoff*bininvx) + 1);
+  int bey = 2 * (static_cast<int> (cutoff*bininvy) + 1);
+  int bez = 2 * (static_cast<int> (cutoff*bininvz) + 1);
+  if (dimension == 2) bez = 1;
+
+  // # of blocks per dim and # of colors per dim
+
+  int nbx = (mbinx + bex - 1) / bex;
+  int nby = (mbiny + bey - 1) / bey;
+  int nbz = (mbinz + bez - 1) / bez;
+
+  int ncx = (nbx > 1) ? 2 : 1;
+  int ncy = (nby > 1) ? 2 : 1;
+  int ncz = (nbz > 1) ? 2 : 1;
+
+  ncolor = ncx*ncy*ncz;
+  nblock = nbx*nby*nbz;
+
+  memory->destroy(colorblock);
+  memory->destroy(blockstart);
+  memory->destroy(blockbins);
+  memory->create(colorblock,ncolor+1,"neigh:colorblock");
+  memory->create(blockstart,nblock+1,"neigh:blockstart");
+  memory->create(blockbins,mbins,"neigh:blockbins");
+
+  // enumerate blocks grouped by color, and bins grouped by block
+
+  int iblock = 0;
+  int m = 0;
+  int icolor = 0;
+  colorblock[0] = 0;
+
+  for (int cz = 0; cz < ncz; cz++)
+    for (int cy = 0; cy < ncy; cy++)
+      for (int cx = 0; cx < ncx; cx++) {
+        for (int ibz = cz; ibz < nbz; ibz += ncz)
+          for (int iby = cy; iby < nby; iby += ncy)
+            for (int ibx = cx; ibx < nbx; ibx += ncx) {
+              blockstart[iblock] = m;
+              int izlo = ibz*bez;
+              int izhi = MIN(izlo+bez,mbinz);
+              int iylo = iby*bey;
+              int iyhi = MIN(iylo+bey,mbiny);
+              int ixlo = ibx*bex;
+              int ixhi = MIN(ixlo+bex,mbinx);
+              for (int iz = izlo; iz < izhi; iz++)
+                for (int iy = iylo; iy < iyhi; iy++)
+                  for (int ix = ixlo; ix < ixhi; ix++)
+                    blockbins[m++] = iz*mbiny*mbinx + iy*mbinx + ix;
+              iblock++;
+            }
+        icolor++;
+        colorblock[icolor] = iblock;
+      }
+
+  blockstart[nblock] = m;
+}
+
 /* ---------------------------------------------------------------------- */
 
 bigint NBin::memory_usage()
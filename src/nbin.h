@@ -35,6 +35,19 @@ class NBin : protected Pointers {
   int *bins;                   // index of next atom in same bin
   int *atom2bin;               // bin assignment for each atom (local+ghost)
 
+  // lock-free color partition of bins for threaded force kernels
+  // bins are grouped into blocks, blocks into colors, such that the
+  //   interaction halos of same-color blocks are disjoint:
+  //   threads owning different blocks of one color can accumulate
+  //   forces without replication or atomics, colors are processed
+  //   one after the other with a barrier in between
+
+  int ncolor;                  // # of colors, 0 if no valid partition
+  int nblock;                  // # of bin blocks
+  int *colorblock;             // first block of each color (ncolor+1)
+  int *blockstart;             // offset into blockbins per block (nblock+1)
+  int *blockbins;              // bin IDs grouped by block
+
   double cutoff_custom;        // cutoff set by requestor
 
   NBin(class LAMMPS *);
@@ -47,6 +60,8 @@ class NBin : protected Pointers {
   virtual void setup_bins(int) = 0;
   virtual void bin_atoms() = 0;
 
+  void build_color_partition();
+
  protected:
 
   // data from Neighbor class
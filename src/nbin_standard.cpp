@@ -183,6 +183,10 @@ void NBinStandard::setup_bins(int style)
   bigint bbin = ((bigint) mbinx) * ((bigint) mbiny) * ((bigint) mbinz) + 1;
   if (bbin > MAXSMALLINT) error->one(FLERR,"Too many neighbor bins");
   mbins = bbin;
+
+  // rebuild the lock-free color partition for the new bin grid
+
+  build_color_partition();
 }
 
 /* ----------------------------------------------------------------------
@@ -204,27 +208,43 @@ void NBinStandard::bin_atoms()
   int nlocal = atom->nlocal;
   int nall = nlocal + atom->nghost;
 
+  // bin index computation is independent per atom, so it can be threaded
+  // linked-list insertion stays serial to preserve the list ordering
+
   if (includegroup) {
     int bitmask = group->bitmask[includegroup];
+    int nfirst = atom->nfirst;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (i = nlocal; i < nall; i++)
+      if (mask[i] & bitmask) atom2bin[i] = coord2bin(x[i]);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (i = 0; i < nfirst; i++) atom2bin[i] = coord2bin(x[i]);
+
     for (i = nall-1; i >= nlocal; i--) {
       if (mask[i] & bitmask) {
-        ibin = coord2bin(x[i]);
-        atom2bin[i] = ibin;
+        ibin = atom2bin[i];
         bins[i] = binhead[ibin];
         binhead[ibin] = i;
       }
     }
-    for (i = atom->nfirst-1; i >= 0; i--) {
-      ibin = coord2bin(x[i]);
-      atom2bin[i] = ibin;
+    for (i = nfirst-1; i >= 0; i--) {
+      ibin = atom2bin[i];
       bins[i] = binhead[ibin];
       binhead[ibin] = i;
     }
 
   } else {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (i = 0; i < nall; i++) atom2bin[i] = coord2bin(x[i]);
+
     for (i = nall-1; i >= 0; i--) {
-      ibin = coord2bin(x[i]);
-      atom2bin[i] = ibin;
+      ibin = atom2bin[i];
       bins[i] = binhead[ibin];
       binhead[ibin] = i;
     }
@@ -59,6 +59,7 @@ NeighList::NeighList(LAMMPS *lmp) : Pointers(lmp)
   listcopy = NULL;
   listskip = NULL;
   listfull = NULL;
+  listtrim = NULL;
 
   fix_bond = NULL;
 
@@ -160,6 +161,9 @@ void NeighList::post_constructor(NeighRequest *nq)
   if (nq->halffull)
     listfull = neighbor->lists[nq->halffulllist];
 
+  if (nq->trim)
+    listtrim = neighbor->lists[nq->trimlist];
+
   if (nq->bond) fix_bond = (Fix *) nq->requestor;
 }
 
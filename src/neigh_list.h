@@ -19,6 +19,18 @@
 
 namespace LAMMPS_NS {
 
+// NeighList stores one variable-length jlist per atom, paged in MyPage
+//   chunks, and that layout is the contract consumed by every pair
+//   style, fix, and compute that requests a list
+// cluster-pair layouts (blocks of 4/8 i-atoms vs j-clusters, as used by
+//   SIMD-specialized MD engines for high vector-lane occupancy) are
+//   deliberately not a second core format: each consumer loop would
+//   need a rewrite per layout, and forces computed per cluster must be
+//   masked back to per-atom arrays for fixes and computes
+// accelerator packages supply such layouts privately instead:
+//   USER-INTEL repacks this list into its own tiled form during build
+//   and keeps the repacked copy on the package side
+
 class NeighList : protected Pointers {
  public:
   int index;                   // index of which neigh list this is
@@ -82,6 +94,8 @@ class NeighList : protected Pointers {
   NeighList *listcopy;          // me = copy list, point to list I copy from
   NeighList *listskip;          // me = skip list, point to list I skip from
   NeighList *listfull;          // me = half list, point to full I derive from
+  NeighList *listtrim;          // me = trim list, point to longer-cutoff
+                                //   list I trim from
 
   class Fix *fix_bond;          // fix that stores bond info
 
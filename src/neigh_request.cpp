@@ -86,6 +86,8 @@ NeighRequest::NeighRequest(LAMMPS *lmp) : Pointers(lmp)
   copylist = -1;
   halffull = 0;
   halffulllist = -1;
+  trim = 0;
+  trimlist = -1;
   unique = 0;
 
   // internal settings
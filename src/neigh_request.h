@@ -98,6 +98,10 @@ class NeighRequest : protected Pointers {
   int halffull;          // 1 if half list computed from another full list
   int halffulllist;      // index of full list to derive half from
 
+  int trim;              // 1 if list computed by trimming another list
+                         //   with a longer cutoff to my shorter cutoff
+  int trimlist;          // index of longer-cutoff list to trim from
+
   int unique;            // 1 if this list requires its own
                          // NStencil, Nbin class - because of requestor cutoff
 
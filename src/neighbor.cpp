@@ -93,6 +93,13 @@ pairclass(NULL), pairnames(NULL), pairmasks(NULL)
   binsizeflag = 0;
   build_once = 0;
   cluster_check = 0;
+  delta_flag = 0;
+  delta_frac = 0.5;
+  ndelta_skip = 0;
+  adapt_flag = 0;
+  adapt_nbuild = 0;
+  adapt_minago = 0;
+  adapt_ndanger = 0;
   ago = -1;
 
   cutneighmax = 0.0;
@@ -242,7 +249,10 @@ void Neighbor::init()
 {
   int i,j,n;
 
-  ncalls = ndanger = 0;
+  ncalls = ndanger = ndelta_skip = 0;
+  adapt_nbuild = 0;
+  adapt_minago = MAXSMALLINT;
+  adapt_ndanger = 0;
   dimension = domain->dimension;
   triclinic = domain->triclinic;
   newton_pair = force->newton_pair;
@@ -252,6 +262,9 @@ void Neighbor::init()
   if (delay > 0 && (delay % every) != 0)
     error->all(FLERR,"Neighbor delay must be 0 or multiple of every setting");
 
+  if (adapt_flag && dist_check == 0)
+    error->all(FLERR,"Neigh_modify adapt yes requires check yes");
+
   if (pgsize < 10*oneatom)
     error->all(FLERR,"Neighbor page size must be >= 10x the one atom setting");
 
@@ -392,7 +405,7 @@ void Neighbor::init()
 
   // free if not needed for this run
 
-  if (dist_check == 0) {
+  if (dist_check == 0 && delta_flag == 0) {
     memory->destroy(xhold);
     maxhold = 0;
     xhold = NULL;
@@ -400,7 +413,7 @@ void Neighbor::init()
 
   // first time allocation
 
-  if (dist_check) {
+  if (dist_check || delta_flag) {
     if (maxhold == 0) {
       maxhold = atom->nmax;
       memory->create(xhold,maxhold,3,"neigh:xhold");
@@ -665,12 +678,14 @@ int Neighbor::init_pair()
   //   (2) skip = create any new non-skip lists needed by pair hybrid skip lists
   //   (3) granular = adjust parent and skip lists for granular onesided usage
   //   (4) h/f = pair up any matching half/full lists
-  //   (5) copy = convert as many lists as possible to copy lists
+  //   (5) trim = derive shorter custom-cutoff lists from perpetual lists
+  //   (6) copy = convert as many lists as possible to copy lists
   // order of morph methods matters:
   //   (3) after (2), b/c it adjusts lists created by (2)
   //   (4) after (2) and (3),
   //       b/c (2) may create new full lists, (3) may change them
-  //   (5) last, after all lists are finalized, so all possible copies found
+  //   (5) after (4), so lists derivable as half/full are not trimmed
+  //   (6) last, after all lists are finalized, so all possible copies found
 
   int nrequest_original = nrequest;
 
@@ -678,6 +693,7 @@ int Neighbor::init_pair()
   morph_skip();
   morph_granular();     // this method can change flags set by requestor
   morph_halffull();
+  morph_trim();
   morph_copy();
 
   // create new lists, one per request including added requests
@@ -874,11 +890,12 @@ int Neighbor::init_pair()
   while (!done) {
     done = 1;
     for (i = 0; i < npair_perpetual; i++) {
-      for (k = 0; k < 3; k++) {
+      for (k = 0; k < 4; k++) {
         ptr = NULL;
         if (k == 0) ptr = lists[plist[i]]->listcopy;
         if (k == 1) ptr = lists[plist[i]]->listskip;
         if (k == 2) ptr = lists[plist[i]]->listfull;
+        if (k == 3) ptr = lists[plist[i]]->listtrim;
         if (ptr == NULL) continue;
         for (m = 0; m < nrequest; m++)
           if (ptr == lists[m]) break;
@@ -1092,6 +1109,17 @@ void Neighbor::morph_granular()
 /* ----------------------------------------------------------------------
    scan NeighRequests for possible half lists to derive from full lists
    if 2 requests match, set half list to derive from full list
+   the derivation is deliberately one-way: a full list can be pruned to
+     a half list with no distance math (see npair_halffull styles), but
+     the transpose full-from-half is not possible from list data alone
+   with newton on, a pair of a local atom and a ghost owned by another
+     proc may be stored only on the other proc, so this proc's half list
+     does not contain all pairs its full list needs; even in serial, the
+     reverse entry for an i/ghost-j pair is j-local/ghost-image-of-i,
+     and locating that image requires coordinate tests comparable in
+     cost to the distance checks a fresh build would do
+   requests that need both kinds thus get the full list built and the
+     half list derived, never the other way around
 ------------------------------------------------------------------------- */
 
 void Neighbor::morph_halffull()
@@ -1160,6 +1188,89 @@ void Neighbor::morph_halffull()
   }
 }
 
+/* ----------------------------------------------------------------------
+   scan NeighRequests for occasional lists with a shorter custom cutoff
+   if a perpetual list stores a superset of their pairs, derive them by
+     trimming the perpetual list to the shorter cutoff instead of
+     building them from scratch via bin/stencil traversal
+------------------------------------------------------------------------- */
+
+void Neighbor::morph_trim()
+{
+  int i,j,inewton,jnewton;
+  NeighRequest *irq,*jrq;
+
+  for (i = 0; i < nrequest; i++) {
+    irq = requests[i];
+
+    // only occasional lists with a custom shorter cutoff are trimmed
+    // lists already derived another way are left alone
+
+    if (!irq->occasional) continue;
+    if (!irq->cut || irq->cutoff <= 0.0) continue;
+    if (irq->copy || irq->halffull || irq->skip) continue;
+
+    // exclude lists with structure or build options a trim cannot honor
+
+    if (irq->ghost || irq->size || irq->history || irq->bond) continue;
+    if (irq->granonesided) continue;
+    if (irq->respainner || irq->respamiddle || irq->respaouter) continue;
+    if (irq->intel || irq->ssa) continue;
+    if (irq->kokkos_host || irq->kokkos_device) continue;
+
+    // check all other lists
+
+    for (j = 0; j < nrequest; j++) {
+      if (i == j) continue;
+      jrq = requests[j];
+
+      // can only trim from a perpetual non-derived list
+      //   with the same structure and no build restrictions
+
+      if (jrq->occasional) continue;
+      if (jrq->copy || jrq->halffull || jrq->skip) continue;
+      if (jrq->ghost || jrq->size || jrq->history || jrq->bond) continue;
+      if (jrq->granonesided) continue;
+      if (jrq->respainner || jrq->respamiddle || jrq->respaouter) continue;
+      if (jrq->intel || jrq->ssa) continue;
+      if (jrq->kokkos_host || jrq->kokkos_device) continue;
+
+      // both lists must be half, or both full
+      // no need to check omp b/c it stores same pairs
+
+      if (irq->half != jrq->half) continue;
+      if (irq->full != jrq->full) continue;
+
+      // both lists must be newton on, or both newton off
+
+      inewton = irq->newton;
+      if (inewton == 0) inewton = force->newton_pair ? 1 : 2;
+      jnewton = jrq->newton;
+      if (jnewton == 0) jnewton = force->newton_pair ? 1 : 2;
+      if (inewton != jnewton) continue;
+
+      // other list must contain all pairs within my cutoff
+      //   for every type pair
+      // a list with the identical cutoff is left for morph_copy()
+
+      if (jrq->cut) {
+        if (irq->cutoff >= jrq->cutoff) continue;
+      } else if (irq->cutoff > cutneighmin) continue;
+
+      // 2 lists are a match
+
+      break;
+    }
+
+    // if matching list exists, derive from it by trimming
+
+    if (j < nrequest) {
+      irq->trim = 1;
+      irq->trimlist = j;
+    }
+  }
+}
+
 /* ----------------------------------------------------------------------
    scan NeighRequests for possible copies
    if 2 requests match, turn one into a copy of the other
@@ -1173,9 +1284,9 @@ void Neighbor::morph_copy()
   for (i = 0; i < nrequest; i++) {
     irq = requests[i];
 
-    // this list is already a copy list due to another morph method
+    // this list is already derived due to another morph method
 
-    if (irq->copy) continue;
+    if (irq->copy || irq->trim) continue;
 
     // check all other lists
 
@@ -1595,7 +1706,7 @@ int Neighbor::choose_bin(NeighRequest *rq)
   // no binning needed
 
   if (style == Neighbor::NSQ) return 0;
-  if (rq->skip || rq->copy || rq->halffull) return 0;
+  if (rq->skip || rq->copy || rq->halffull || rq->trim) return 0;
 
   // use request settings to match exactly one NBin class mask
   // checks are bitwise using NeighConst bit masks
@@ -1635,7 +1746,7 @@ int Neighbor::choose_stencil(NeighRequest *rq)
   // no stencil creation needed
 
   if (style == Neighbor::NSQ) return 0;
-  if (rq->skip || rq->copy || rq->halffull) return 0;
+  if (rq->skip || rq->copy || rq->halffull || rq->trim) return 0;
 
   // convert newton request to newtflag = on or off
 
@@ -1769,6 +1880,13 @@ int Neighbor::choose_pair(NeighRequest *rq)
       return i+1;
     }
 
+    // likewise if trim request, parent list determines all other attributes
+
+    if (rq->trim) {
+      if (!(mask & NP_TRIM)) continue;
+      return i+1;
+    }
+
     // exactly one of half or full is set and must match
 
     if (rq->half) {
@@ -1931,7 +2049,12 @@ int Neighbor::decide()
   ago++;
   if (ago >= delay && ago % every == 0) {
     if (build_once) return 0;
-    if (dist_check == 0) return 1;
+    if (dist_check == 0) {
+      if (delta_flag == 0) return 1;
+      int flag = check_delta();
+      if (flag == 0) ndelta_skip++;
+      return flag;
+    }
     return check_distance();
   } else return 0;
 }
@@ -1945,6 +2068,13 @@ int Neighbor::decide()
      new trigger = 1/2 of reduced skin distance
    for orthogonal box, only need 2 lo/hi corners
    for triclinic, need all 8 corners since deformations can displace all 8
+   displacement is measured against xhold, saved at the last build:
+     atoms are moved by integrators, fixes, minimizers, and box remaps,
+     so no single code path could maintain an incremental max tracker
+   the flag reduction must complete before returning, since the result
+     gates exchange/borders/build this same step - there is no later
+     force call to overlap it with; use larger {every} via
+     neigh_modify to amortize the collective at scale
 ------------------------------------------------------------------------- */
 
 int Neighbor::check_distance()
@@ -1984,13 +2114,15 @@ int Neighbor::check_distance()
   int nlocal = atom->nlocal;
   if (includegroup) nlocal = atom->nfirst;
 
+  // branchless accumulation keeps the displacement sweep vectorizable
+
   int flag = 0;
   for (int i = 0; i < nlocal; i++) {
     delx = x[i][0] - xhold[i][0];
     dely = x[i][1] - xhold[i][1];
     delz = x[i][2] - xhold[i][2];
     rsq = delx*delx + dely*dely + delz*delz;
-    if (rsq > deltasq) flag = 1;
+    flag |= (rsq > deltasq);
   }
 
   int flagall;
@@ -1999,6 +2131,73 @@ int Neighbor::check_distance()
   return flagall;
 }
 
+/* ----------------------------------------------------------------------
+   displacement gate for cadence-driven rebuilds in delta mode
+   return 0 to skip the rebuild if no atom moved more than
+     delta_frac * trigger distance since the last build
+   tighter than the check_distance() criterion so skipped rebuilds can
+   never produce a list that check yes would have considered stale
+------------------------------------------------------------------------- */
+
+int Neighbor::check_delta()
+{
+  double delx,dely,delz,rsq;
+
+  double deltasq = delta_frac*delta_frac * triggersq;
+
+  double **x = atom->x;
+  int nlocal = atom->nlocal;
+  if (includegroup) nlocal = atom->nfirst;
+
+  int flag = 0;
+  for (int i = 0; i < nlocal; i++) {
+    delx = x[i][0] - xhold[i][0];
+    dely = x[i][1] - xhold[i][1];
+    delz = x[i][2] - xhold[i][2];
+    rsq = delx*delx + dely*dely + delz*delz;
+    flag |= (rsq > deltasq);
+  }
+
+  int flagall;
+  MPI_Allreduce(&flag,&flagall,1,MPI_INT,MPI_MAX,world);
+  return flagall;
+}
+
+/* ----------------------------------------------------------------------
+   retune delay from observed rebuild behavior, called at start of build
+   a dangerous build means the current delay is already too long: halve it
+   else track the smallest interval between displacement-triggered builds
+     over a window of builds and set delay just below it
+   delay is kept a multiple of every, as enforced by init()
+------------------------------------------------------------------------- */
+
+#define ADAPT_WINDOW 10
+#define ADAPT_MARGIN 2
+
+void Neighbor::adapt_delay()
+{
+  // back off immediately on a dangerous build, then restart the window
+
+  if (ndanger > adapt_ndanger) {
+    adapt_ndanger = ndanger;
+    delay = (delay/2/every) * every;
+    adapt_nbuild = 0;
+    adapt_minago = MAXSMALLINT;
+    return;
+  }
+
+  adapt_minago = MIN(adapt_minago,ago);
+  adapt_nbuild++;
+
+  if (adapt_nbuild >= ADAPT_WINDOW) {
+    int d = ((adapt_minago - ADAPT_MARGIN)/every) * every;
+    if (d < 0) d = 0;
+    delay = d;
+    adapt_nbuild = 0;
+    adapt_minago = MAXSMALLINT;
+  }
+}
+
 /* ----------------------------------------------------------------------
    build perpetual neighbor lists
    called at setup and every few timesteps during run or minimization
@@ -2009,6 +2208,13 @@ void Neighbor::build(int topoflag)
 {
   int i,m;
 
+  // retune delay before resetting ago
+  // only displacement-triggered builds inform the controller,
+  //   forced builds (setup, restart, fix-induced) are ignored
+
+  if (adapt_flag && dist_check && ago >= MAX(every,delay) && ago % every == 0)
+    adapt_delay();
+
   ago = 0;
   ncalls++;
   lastcall = update->ntimestep;
@@ -2023,7 +2229,7 @@ void Neighbor::build(int topoflag)
 
   // store current atom positions and box size if needed
 
-  if (dist_check) {
+  if (dist_check || delta_flag) {
     double **x = atom->x;
     if (includegroup) nlocal = atom->nfirst;
     if (atom->nmax > maxhold) {
@@ -2152,6 +2358,8 @@ void Neighbor::build_one(class NeighList *mylist, int preflag)
     build_one(mylist->listcopy,preflag);
   if (mylist->listfull && mylist->listfull->occasional)
     build_one(mylist->listfull,preflag);
+  if (mylist->listtrim && mylist->listtrim->occasional)
+    build_one(mylist->listtrim,preflag);
 
   // create stencil if hasn't been created since last setup_bins() call
 
@@ -2232,6 +2440,22 @@ void Neighbor::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) dist_check = 0;
       else error->all(FLERR,"Illegal neigh_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"delta") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"no") == 0) delta_flag = 0;
+      else {
+        delta_flag = 1;
+        delta_frac = force->numeric(FLERR,arg[iarg+1]);
+        if (delta_frac <= 0.0 || delta_frac > 1.0)
+          error->all(FLERR,"Illegal neigh_modify command");
+      }
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"adapt") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) adapt_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) adapt_flag = 0;
+      else error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"once") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) build_once = 1;
@@ -2369,6 +2593,17 @@ int Neighbor::exclude_setting()
   return exclude;
 }
 
+/* ----------------------------------------------------------------------
+   return Nth NBin instance - used by pair styles that walk the bin grid
+   return NULL if it does not exist
+------------------------------------------------------------------------- */
+
+NBin *Neighbor::find_bin(int which)
+{
+  if (which < 0 || which >= nbin) return NULL;
+  return neigh_bin[which];
+}
+
 /* ----------------------------------------------------------------------
    return # of bytes of allocated memory
 ------------------------------------------------------------------------- */
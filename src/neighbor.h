@@ -31,6 +31,11 @@ class Neighbor : protected Pointers {
   int oneatom;                     // max # of neighbors for one atom
   int includegroup;                // only build pairwise lists for this group
   int build_once;                  // 1 if only build lists once per run
+  int delta_flag;                  // 1 = skip cadence rebuilds if no atom
+                                   //     moved more than delta_frac * trigger
+  double delta_frac;               // fraction of trigger distance for gating
+  int adapt_flag;                  // 1 = retune delay from observed rebuild
+                                   //     intervals and dangerous builds
 
   double skin;                     // skin distance
   double cutneighmin;              // min neighbor cutoff for all type pairs
@@ -49,6 +54,11 @@ class Neighbor : protected Pointers {
 
   bigint ncalls;                   // # of times build has been called
   bigint ndanger;                  // # of dangerous builds
+  bigint ndelta_skip;              // # of cadence rebuilds skipped by delta
+
+  int adapt_nbuild;                // triggered builds in current adapt window
+  int adapt_minago;                // smallest rebuild interval in window
+  bigint adapt_ndanger;            // ndanger as of last adapt update
   bigint lastcall;                 // timestep of last neighbor::build() call
 
   // geometry and static info, used by other Neigh classes
@@ -111,6 +121,8 @@ class Neighbor : protected Pointers {
   int request(void *, int instance=0);
   int decide();                     // decide whether to build or not
   virtual int check_distance();     // check max distance moved since last build
+  int check_delta();                // displacement gate for cadence rebuilds
+  void adapt_delay();               // retune delay from rebuild intervals
   void setup_bins();                // setup bins based on box and cutoff
   virtual void build(int);          // build all perpetual neighbor lists
   virtual void build_topology();    // pairwise topology neighbor lists
@@ -123,6 +135,7 @@ class Neighbor : protected Pointers {
   void exclusion_group_group_delete(int, int);  // rm a group-group exclusion
   int exclude_setting();            // return exclude value to accelerator pkg
   class NeighRequest *find_request(void *);  // find a neighbor request
+  class NBin *find_bin(int);        // return a NBin instance to pair styles
 
   bigint memory_usage();
 
@@ -209,6 +222,7 @@ class Neighbor : protected Pointers {
   void morph_skip();
   void morph_granular();
   void morph_halffull();
+  void morph_trim();
   void morph_copy();
 
   void print_pairwise_info();
@@ -279,6 +293,7 @@ namespace NeighConst {
   static const int NP_SKIP          = 1<<22;
   static const int NP_HALF_FULL     = 1<<23;
   static const int NP_OFF2ON        = 1<<24;
+  static const int NP_TRIM          = 1<<25;
 }
 
 }
@@ -32,6 +32,9 @@ NPair::NPair(LAMMPS *lmp)
   last_build = -1;
   mycutneighsq = NULL;
   molecular = atom->molecular;
+  excl_bitflag = 0;
+  excl_grp1 = excl_grp2 = excl_mol = NULL;
+  max_excl = 0;
   copymode = 0;
   execution_space = Host;
 }
@@ -43,6 +46,9 @@ NPair::~NPair()
   if (copymode) return;
 
   memory->destroy(mycutneighsq);
+  memory->destroy(excl_grp1);
+  memory->destroy(excl_grp2);
+  memory->destroy(excl_mol);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -159,6 +165,47 @@ void NPair::build_setup()
   if (nb) copy_bin_info();
   if (ns) copy_stencil_info();
 
+  // compile group/molecule exclusions into per-atom bitmaps
+  // bit m of excl_grp1[i] set = atom i is in 1st group of exclusion m, etc
+  // exclusion() then tests a candidate pair with two AND ops instead of
+  //   looping over the exclusion list for every pair
+  // requires < 32 exclusions of each kind, else fall back to the loops
+
+  excl_bitflag = 0;
+  if (exclude && (nex_group || nex_mol) && nex_group < 32 && nex_mol < 32) {
+    int i,m,b1,b2;
+    int nall = atom->nlocal + atom->nghost;
+    if (nall > max_excl) {
+      max_excl = atom->nmax;
+      memory->destroy(excl_grp1);
+      memory->destroy(excl_grp2);
+      memory->destroy(excl_mol);
+      memory->create(excl_grp1,max_excl,"npair:excl_grp1");
+      memory->create(excl_grp2,max_excl,"npair:excl_grp2");
+      memory->create(excl_mol,max_excl,"npair:excl_mol");
+    }
+    int *mask = atom->mask;
+
+    for (i = 0; i < nall; i++) {
+      b1 = b2 = 0;
+      for (m = 0; m < nex_group; m++) {
+        if (mask[i] & ex1_bit[m]) b1 |= 1 << m;
+        if (mask[i] & ex2_bit[m]) b2 |= 1 << m;
+      }
+      excl_grp1[i] = b1;
+      excl_grp2[i] = b2;
+    }
+
+    for (i = 0; i < nall; i++) {
+      b1 = 0;
+      for (m = 0; m < nex_mol; m++)
+        if (mask[i] & ex_mol_bit[m]) b1 |= 1 << m;
+      excl_mol[i] = b1;
+    }
+
+    excl_bitflag = 1;
+  }
+
   // set here, since build_setup() always called before build()
 
   last_build = update->ntimestep;
@@ -176,7 +223,16 @@ int NPair::exclusion(int i, int j, int itype, int jtype,
 
   if (nex_type && ex_type[itype][jtype]) return 1;
 
-  if (nex_group) {
+  // bitmaps compiled in build_setup() replace the per-pair list loops
+  // group test = exists m with i in group 1 and j in group 2 or vice versa
+  // mol bitmap only gates the loop, intra/inter still decided per entry
+
+  if (excl_bitflag) {
+    if ((excl_grp1[i] & excl_grp2[j]) || (excl_grp2[i] & excl_grp1[j]))
+      return 1;
+    if (!(excl_mol[i] & excl_mol[j])) return 0;
+
+  } else if (nex_group) {
     for (m = 0; m < nex_group; m++) {
       if (mask[i] & ex1_bit[m] && mask[j] & ex2_bit[m]) return 1;
       if (mask[i] & ex2_bit[m] && mask[j] & ex1_bit[m]) return 1;
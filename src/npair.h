@@ -65,6 +65,14 @@ class NPair : protected Pointers {
   int *ex_mol_intra;               // 0 = exclude if in 2 molecules (inter)
                                    // 1 = exclude if in same molecule (intra)
 
+  // group/molecule exclusions compiled into per-atom bitmaps
+  // built once per neighbor build in build_setup()
+
+  int excl_bitflag;                // 1 if bitmaps are built and usable
+  int *excl_grp1,*excl_grp2;       // bit m set = atom in group 1/2 of excl m
+  int *excl_mol;                   // bit m set = atom in mol exclusion m
+  int max_excl;                    // allocated length of bitmaps
+
   // special data from Neighbor class
 
   int *special_flag;
@@ -108,6 +116,14 @@ class NPair : protected Pointers {
   // if it is and special flag is 1 (both coeffs are 1.0), return 0
   // if it is and special flag is 2 (otherwise), return 1,2,3
   //   for which level of neighbor it is (and which coeff it maps to)
+  // this search runs once per candidate pair at list-build time:
+  //   fully excluded pairs are dropped from the list, weighted pairs
+  //   carry their level in the top bits of j (see sbmask in pointers.h),
+  //   so pair kernels never search, they only index special_lj/coul
+  // the linear scan is intentional: a 1-2/1-3/1-4 list is at most a few
+  //   dozen L1-resident tags, and fixes like bond/create can grow the
+  //   lists between builds, which would invalidate any sorted or hashed
+  //   per-atom index built on top of them
 
   inline int find_special(const tagint *list, const int *nspecial,
                           const tagint tag) const {
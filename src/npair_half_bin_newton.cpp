@@ -21,6 +21,10 @@
 #include "my_page.h"
 #include "error.h"
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -35,10 +39,7 @@ NPairHalfBinNewton::NPairHalfBinNewton(LAMMPS *lmp) : NPair(lmp) {}
 
 void NPairHalfBinNewton::build(NeighList *list)
 {
-  int i,j,k,n,itype,jtype,ibin,which,imol,iatom,moltemplate;
-  tagint tagprev;
-  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
-  int *neighptr;
+  int moltemplate;
 
   double **x = atom->x;
   int *type = atom->type;
@@ -59,12 +60,39 @@ void NPairHalfBinNewton::build(NeighList *list)
   int *ilist = list->ilist;
   int *numneigh = list->numneigh;
   int **firstneigh = list->firstneigh;
-  MyPage<int> *ipage = list->ipage;
 
-  int inum = 0;
+  // bin sizes and max reach of this list, for stencil bin pruning below
+  // mirror the cutoff logic NStencil used to build the stencil
+
+  double binsizex = 1.0/bininvx;
+  double binsizey = 1.0/bininvy;
+  double binsizez = 1.0/bininvz;
+  double cutstencilsq = neighbor->cutneighmaxsq;
+  if (cutoff_custom > 0.0) cutstencilsq = cutoff_custom*cutoff_custom;
+
+  // threaded build: each thread fills pages from its own page set
+  // every owned atom gets a list, so ilist/inum can be set directly
+
+#if defined(_OPENMP)
+#pragma omp parallel default(shared)
+#endif
+  {
+  int tid = 0;
+#if defined(_OPENMP)
+  tid = omp_get_thread_num();
+#endif
+  MyPage<int> *ipage = &list->ipage[tid];
   ipage->reset();
 
-  for (i = 0; i < nlocal; i++) {
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic,8)
+#endif
+  for (int i = 0; i < nlocal; i++) {
+    int j,k,n,itype,jtype,ibin,which,imol,iatom,ix,iy,iz;
+    tagint tagprev;
+    double xtmp,ytmp,ztmp,delx,dely,delz,rsq,fx,fy,fz,dx,dy,dz;
+    int *neighptr,*sxyz;
+
     n = 0;
     neighptr = ipage->vget();
 
@@ -118,9 +146,29 @@ void NPairHalfBinNewton::build(NeighList *list)
     }
 
     // loop over all atoms in other bins in stencil, store every pair
+    // position of i within its bin gives an exact lower bound on the
+    //   distance from i to each stencil bin, so bins i cannot reach are
+    //   skipped without scanning their atoms; with large cutoffs many
+    //   stencil bins near the shell boundary fail this test
 
     ibin = atom2bin[i];
+    ix = ibin % mbinx;
+    iy = ibin/mbinx % mbiny;
+    iz = ibin/(mbinx*mbiny);
+    fx = xtmp - bboxlo[0] - (ix+mbinxlo)*binsizex;
+    fy = ytmp - bboxlo[1] - (iy+mbinylo)*binsizey;
+    fz = ztmp - bboxlo[2] - (iz+mbinzlo)*binsizez;
+
     for (k = 0; k < nstencil; k++) {
+      sxyz = stencilxyz[k];
+      dx = sxyz[0] > 0 ? sxyz[0]*binsizex - fx :
+        (sxyz[0] < 0 ? fx - (sxyz[0]+1)*binsizex : 0.0);
+      dy = sxyz[1] > 0 ? sxyz[1]*binsizey - fy :
+        (sxyz[1] < 0 ? fy - (sxyz[1]+1)*binsizey : 0.0);
+      dz = sxyz[2] > 0 ? sxyz[2]*binsizez - fz :
+        (sxyz[2] < 0 ? fz - (sxyz[2]+1)*binsizez : 0.0);
+      if (dx*dx + dy*dy + dz*dz > cutstencilsq) continue;
+
       for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
         jtype = type[j];
         if (exclude && exclusion(i,j,itype,jtype,mask,molecule)) continue;
@@ -149,13 +197,14 @@ void NPairHalfBinNewton::build(NeighList *list)
       }
     }
 
-    ilist[inum++] = i;
+    ilist[i] = i;
     firstneigh[i] = neighptr;
     numneigh[i] = n;
     ipage->vgot(n);
     if (ipage->status())
       error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
   }
+  }
 
-  list->inum = inum;
+  list->inum = nlocal;
 }
@@ -120,6 +120,15 @@ void NPairHalfMultiNewton::build(NeighList *list)
 
     // loop over all atoms in other bins in stencil, store every pair
     // skip if i,j neighbor cutoff is less than bin distance
+    // all per-type stencils index one grid of bins sized from the
+    //   shortest cutoff, so for large cutoff ratios the long-cutoff
+    //   stencils span many small bins whose atoms are mostly pruned
+    //   by the distance check below
+    // per-type bin grids would avoid those scans but require one
+    //   NBin instance per cutoff class and cross-grid stencils,
+    //   which the NBin/NStencil factory does not support
+    // remedy for high size-ratio systems is an intermediate bin
+    //   size via neigh_modify binsize
 
     ibin = atom2bin[i];
     s = stencil_multi[itype];
@@ -31,6 +31,12 @@ NPairHalfSizeBinNewton::NPairHalfSizeBinNewton(LAMMPS *lmp) : NPair(lmp) {}
    binned neighbor list construction with full Newton's 3rd law
    each owned atom i checks its own bin and other bins in Newton stencil
    every pair stored exactly once by some processor
+   pages must be materialized even at low bin occupancy:
+     FixNeighHistory keeps per-contact shear history in arrays parallel
+     to the list entries, so granular pair styles cannot walk cell pairs
+     directly - the list is the key that persists contacts across steps
+   amortize build cost for frequently rebuilding flows with a larger
+     skin and neigh_modify every/delay/check settings
 ------------------------------------------------------------------------- */
 
 void NPairHalfSizeBinNewton::build(NeighList *list)
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "npair_trim.h"
+#include "neigh_list.h"
+#include "atom.h"
+#include "my_page.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+NPairTrim::NPairTrim(LAMMPS *lmp) : NPair(lmp) {}
+
+/* ----------------------------------------------------------------------
+   trim parent list with longer cutoff to this list's shorter cutoff
+   parent stores a superset of my pairs, so no bin/stencil pass is needed
+   works for half or full parent lists, newton on or off
+------------------------------------------------------------------------- */
+
+void NPairTrim::build(NeighList *list)
+{
+  int i,j,ii,jj,n,jnum,joriginal;
+  int *neighptr,*jlist;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+
+  double **x = atom->x;
+
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+  MyPage<int> *ipage = list->ipage;
+
+  int *ilist_trim = list->listtrim->ilist;
+  int *numneigh_trim = list->listtrim->numneigh;
+  int **firstneigh_trim = list->listtrim->firstneigh;
+  int inum_trim = list->listtrim->inum;
+
+  double cutsq_custom = cutoff_custom * cutoff_custom;
+
+  int inum = 0;
+  ipage->reset();
+
+  // loop over parent list and keep pairs within my shorter cutoff
+
+  for (ii = 0; ii < inum_trim; ii++) {
+    n = 0;
+    neighptr = ipage->vget();
+
+    i = ilist_trim[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+
+    // loop over parent's neighbor list
+
+    jlist = firstneigh_trim[i];
+    jnum = numneigh_trim[i];
+
+    for (jj = 0; jj < jnum; jj++) {
+      joriginal = jlist[jj];
+      j = joriginal & NEIGHMASK;
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      if (rsq > cutsq_custom) continue;
+      neighptr[n++] = joriginal;
+    }
+
+    ilist[inum++] = i;
+    firstneigh[i] = neighptr;
+    numneigh[i] = n;
+    ipage->vgot(n);
+    if (ipage->status())
+      error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
+  }
+
+  list->inum = inum;
+  list->gnum = 0;
+}
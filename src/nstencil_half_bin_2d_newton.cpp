@@ -19,7 +19,10 @@ using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
 
-NStencilHalfBin2dNewton::NStencilHalfBin2dNewton(LAMMPS *lmp) : NStencil(lmp) {}
+NStencilHalfBin2dNewton::NStencilHalfBin2dNewton(LAMMPS *lmp) : NStencil(lmp)
+{
+  xyzflag = 1;
+}
 
 /* ----------------------------------------------------------------------
    create stencil based on bin geometry and cutoff
@@ -34,6 +37,10 @@ void NStencilHalfBin2dNewton::create()
   for (j = 0; j <= sy; j++)
     for (i = -sx; i <= sx; i++)
       if (j > 0 || (j == 0 && i > 0))
-        if (bin_distance(i,j,0) < cutneighmaxsq)
+        if (bin_distance(i,j,0) < cutneighmaxsq) {
+          stencilxyz[nstencil][0] = i;
+          stencilxyz[nstencil][1] = j;
+          stencilxyz[nstencil][2] = 0;
           stencil[nstencil++] = j*mbinx + i;
+        }
 }
@@ -19,7 +19,10 @@ using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
 
-NStencilHalfBin3dNewton::NStencilHalfBin3dNewton(LAMMPS *lmp) : NStencil(lmp) {}
+NStencilHalfBin3dNewton::NStencilHalfBin3dNewton(LAMMPS *lmp) : NStencil(lmp)
+{
+  xyzflag = 1;
+}
 
 /* ----------------------------------------------------------------------
    create stencil based on bin geometry and cutoff
@@ -35,6 +38,10 @@ void NStencilHalfBin3dNewton::create()
     for (j = -sy; j <= sy; j++)
       for (i = -sx; i <= sx; i++)
         if (k > 0 || j > 0 || (j == 0 && i > 0))
-          if (bin_distance(i,j,k) < cutneighmaxsq)
+          if (bin_distance(i,j,k) < cutneighmaxsq) {
+            stencilxyz[nstencil][0] = i;
+            stencilxyz[nstencil][1] = j;
+            stencilxyz[nstencil][2] = k;
             stencil[nstencil++] = k*mbiny*mbinx + j*mbinx + i;
+          }
 }
@@ -24,7 +24,22 @@ using namespace LAMMPS_NS;
 
 #define LB_FACTOR 1.5
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   derived classes rebuild the bond/angle/dihedral/improper lists each
+     reneighboring by resolving the stored global IDs via atom->map()
+   the map lookups happen only here, once per reneighbor; the bonded
+     force loops then index the lists directly, so they are already
+     off the per-step hot path
+   replacing the IDs with fragment-local offsets kept valid by
+     migrating whole molecules contiguously was considered for small
+     solvents and rejected: exchange, borders, and every fix's
+     pack/unpack operate per atom, and atoms of one molecule legally
+     straddle proc boundaries, so the contiguity invariant cannot be
+     kept without reworking all of them
+   the cheap existing lever is atom_modify map array, which turns each
+     lookup into one direct array index at the price of an
+     natoms-length array per proc
+------------------------------------------------------------------------- */
 
 NTopo::NTopo(LAMMPS *lmp) : Pointers(lmp)
 {
@@ -51,6 +51,16 @@ void NTopoAngleAll::build()
   int nmissing = 0;
   nanglelist = 0;
 
+  // grow anglelist at most once per build
+  // sum of num_angle over local atoms is an upper bound on its final length
+
+  int nanglemax = 0;
+  for (i = 0; i < nlocal; i++) nanglemax += num_angle[i];
+  if (nanglemax > maxangle) {
+    while (maxangle < nanglemax) maxangle += DELTA;
+    memory->grow(anglelist,maxangle,4,"neigh_topo:anglelist");
+  }
+
   for (i = 0; i < nlocal; i++)
     for (m = 0; m < num_angle[i]; m++) {
       atom1 = atom->map(angle_atom1[i][m]);
@@ -73,10 +83,6 @@ void NTopoAngleAll::build()
       atom2 = domain->closest_image(i,atom2);
       atom3 = domain->closest_image(i,atom3);
       if (newton_bond || (i <= atom1 && i <= atom2 && i <= atom3)) {
-        if (nanglelist == maxangle) {
-          maxangle += DELTA;
-          memory->grow(anglelist,maxangle,4,"neigh_topo:anglelist");
-        }
         anglelist[nanglelist][0] = atom1;
         anglelist[nanglelist][1] = atom2;
         anglelist[nanglelist][2] = atom3;
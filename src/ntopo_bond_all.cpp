@@ -50,6 +50,16 @@ void NTopoBondAll::build()
   int nmissing = 0;
   nbondlist = 0;
 
+  // grow bondlist at most once per build
+  // sum of num_bond over local atoms is an upper bound on its final length
+
+  int nbondmax = 0;
+  for (i = 0; i < nlocal; i++) nbondmax += num_bond[i];
+  if (nbondmax > maxbond) {
+    while (maxbond < nbondmax) maxbond += DELTA;
+    memory->grow(bondlist,maxbond,3,"neigh_topo:bondlist");
+  }
+
   for (i = 0; i < nlocal; i++)
     for (m = 0; m < num_bond[i]; m++) {
       atom1 = atom->map(bond_atom[i][m]);
@@ -66,10 +76,6 @@ void NTopoBondAll::build()
       }
       atom1 = domain->closest_image(i,atom1);
       if (newton_bond || i < atom1) {
-        if (nbondlist == maxbond) {
-          maxbond += DELTA;
-          memory->grow(bondlist,maxbond,3,"neigh_topo:bondlist");
-        }
         bondlist[nbondlist][0] = i;
         bondlist[nbondlist][1] = atom1;
         bondlist[nbondlist][2] = bond_type[i][m];
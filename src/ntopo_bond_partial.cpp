@@ -50,6 +50,16 @@ void NTopoBondPartial::build()
   int nmissing = 0;
   nbondlist = 0;
 
+  // grow bondlist at most once per build
+  // sum of num_bond over local atoms is an upper bound on its final length
+
+  int nbondmax = 0;
+  for (i = 0; i < nlocal; i++) nbondmax += num_bond[i];
+  if (nbondmax > maxbond) {
+    while (maxbond < nbondmax) maxbond += DELTA;
+    memory->grow(bondlist,maxbond,3,"neigh_topo:bondlist");
+  }
+
   for (i = 0; i < nlocal; i++)
     for (m = 0; m < num_bond[i]; m++) {
       if (bond_type[i][m] <= 0) continue;
@@ -67,10 +77,6 @@ void NTopoBondPartial::build()
       }
       atom1 = domain->closest_image(i,atom1);
       if (newton_bond || i < atom1) {
-        if (nbondlist == maxbond) {
-          maxbond += DELTA;
-          memory->grow(bondlist,maxbond,3,"neigh_topo:bondlist");
-        }
         bondlist[nbondlist][0] = i;
         bondlist[nbondlist][1] = atom1;
         bondlist[nbondlist][2] = bond_type[i][m];
@@ -52,6 +52,16 @@ void NTopoDihedralAll::build()
   int nmissing = 0;
   ndihedrallist = 0;
 
+  // grow dihedrallist at most once per build
+  // sum of num_dihedral over local atoms is an upper bound on its final length
+
+  int ndihedralmax = 0;
+  for (i = 0; i < nlocal; i++) ndihedralmax += num_dihedral[i];
+  if (ndihedralmax > maxdihedral) {
+    while (maxdihedral < ndihedralmax) maxdihedral += DELTA;
+    memory->grow(dihedrallist,maxdihedral,5,"neigh_topo:dihedrallist");
+  }
+
   for (i = 0; i < nlocal; i++)
     for (m = 0; m < num_dihedral[i]; m++) {
       atom1 = atom->map(dihedral_atom1[i][m]);
@@ -79,10 +89,6 @@ void NTopoDihedralAll::build()
       atom4 = domain->closest_image(i,atom4);
       if (newton_bond ||
           (i <= atom1 && i <= atom2 && i <= atom3 && i <= atom4)) {
-        if (ndihedrallist == maxdihedral) {
-          maxdihedral += DELTA;
-          memory->grow(dihedrallist,maxdihedral,5,"neigh_topo:dihedrallist");
-        }
         dihedrallist[ndihedrallist][0] = atom1;
         dihedrallist[ndihedrallist][1] = atom2;
         dihedrallist[ndihedrallist][2] = atom3;
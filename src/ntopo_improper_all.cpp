@@ -52,6 +52,16 @@ void NTopoImproperAll::build()
   int nmissing = 0;
   nimproperlist = 0;
 
+  // grow improperlist at most once per build
+  // sum of num_improper over local atoms is an upper bound on its final length
+
+  int nimpropermax = 0;
+  for (i = 0; i < nlocal; i++) nimpropermax += num_improper[i];
+  if (nimpropermax > maximproper) {
+    while (maximproper < nimpropermax) maximproper += DELTA;
+    memory->grow(improperlist,maximproper,5,"neigh_topo:improperlist");
+  }
+
   for (i = 0; i < nlocal; i++)
     for (m = 0; m < num_improper[i]; m++) {
       atom1 = atom->map(improper_atom1[i][m]);
@@ -79,10 +89,6 @@ void NTopoImproperAll::build()
       atom4 = domain-> closest_image(i,atom4);
       if (newton_bond ||
           (i <= atom1 && i <= atom2 && i <= atom3 && i <= atom4)) {
-        if (nimproperlist == maximproper) {
-          maximproper += DELTA;
-          memory->grow(improperlist,maximproper,5,"neigh_topo:improperlist");
-        }
         improperlist[nimproperlist][0] = atom1;
         improperlist[nimproperlist][1] = atom2;
         improperlist[nimproperlist][2] = atom3;
@@ -121,6 +121,17 @@ void PairDPD::compute(int eflag, int vflag)
         delvz = vztmp - v[j][2];
         dot = delx*delvx + dely*delvy + delz*delvz;
         wd = 1.0 - r/cut[itype][jtype];
+
+        // one serial RanMars stream draws a gaussian per pair, in list
+        //   order; the dpd/omp variant avoids contention on this state
+        //   with an independent per-thread stream, not by sharing it
+        // a counter-based generator keyed on (tag i, tag j, step) would
+        //   make the draws decomposition-invariant, but does not fit
+        //   RanMars: gaussian() is rejection-sampled, consuming a
+        //   variable number of uniforms per value, so a draw cannot be
+        //   indexed by a counter without switching generator families
+        //   and changing every user's thermal noise sequence
+
         randnum = random->gaussian();
 
         // conservative force = a0 * wd
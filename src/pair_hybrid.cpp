@@ -118,6 +118,16 @@ void PairHybrid::compute(int eflag, int vflag)
     if (respa->nhybrid_styles > 0) respaflag = 1;
   }
 
+  // sub-styles are invoked sequentially by design, even when their type
+  //   coverage is disjoint: set_special() swaps the global special-bond
+  //   scale factors in the Force class in and out around each call, and
+  //   with newton_pair on, sub-styles accumulate into overlapping ghost
+  //   entries of atom->f, so concurrent dispatch would race on both
+  // parallelism across cores comes from threading within a sub-style:
+  //   the omp/intel/gpu suffix variants run each sub-style's own skip
+  //   list over all threads in turn, which keeps every core busy without
+  //   partitioning the machine by sub-style
+
   for (m = 0; m < nstyles; m++) {
 
     set_special(m);
@@ -42,12 +42,21 @@ PairLJCut::PairLJCut(LAMMPS *lmp) : Pair(lmp)
 {
   respa_enable = 1;
   writedata = 1;
+
+#ifdef LMP_MIXED_PREC
+  x_single = NULL;
+  nmax_single = 0;
+#endif
 }
 
 /* ---------------------------------------------------------------------- */
 
 PairLJCut::~PairLJCut()
 {
+#ifdef LMP_MIXED_PREC
+  memory->destroy(x_single);
+#endif
+
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
@@ -66,6 +75,33 @@ PairLJCut::~PairLJCut()
 /* ---------------------------------------------------------------------- */
 
 void PairLJCut::compute(int eflag, int vflag)
+{
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else evflag = vflag_fdotr = 0;
+
+  // select a compile-time specialized kernel so the inner loop
+  //   carries no eflag/vflag/newton branches
+
+  if (evflag) {
+    if (eflag) {
+      if (force->newton_pair) eval<1,1,1>();
+      else eval<1,1,0>();
+    } else {
+      if (force->newton_pair) eval<1,0,1>();
+      else eval<1,0,0>();
+    }
+  } else {
+    if (force->newton_pair) eval<0,0,1>();
+    else eval<0,0,0>();
+  }
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int EVFLAG, int EFLAG, int NEWTON_PAIR>
+void PairLJCut::eval()
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
   double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
@@ -73,71 +109,98 @@ void PairLJCut::compute(int eflag, int vflag)
   int *ilist,*jlist,*numneigh,**firstneigh;
 
   evdwl = 0.0;
-  if (eflag || vflag) ev_setup(eflag,vflag);
-  else evflag = vflag_fdotr = 0;
 
   double **x = atom->x;
   double **f = atom->f;
   int *type = atom->type;
   int nlocal = atom->nlocal;
   double *special_lj = force->special_lj;
-  int newton_pair = force->newton_pair;
 
   inum = list->inum;
   ilist = list->ilist;
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
+#ifdef LMP_MIXED_PREC
+
+  // refresh single-precision copy of coords, read many times below
+  // halves coord read bandwidth, force accumulation remains double
+
+  int nall = nlocal + atom->nghost;
+  if (atom->nmax > nmax_single) {
+    memory->destroy(x_single);
+    nmax_single = atom->nmax;
+    memory->create(x_single,nmax_single,3,"pair:x_single");
+  }
+  for (i = 0; i < nall; i++) {
+    x_single[i][0] = (float) x[i][0];
+    x_single[i][1] = (float) x[i][1];
+    x_single[i][2] = (float) x[i][2];
+  }
+  float * const *xc = x_single;
+#else
+  double * const *xc = x;
+#endif
+
   // loop over neighbors of my atoms
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
+    xtmp = xc[i][0];
+    ytmp = xc[i][1];
+    ztmp = xc[i][2];
     itype = type[i];
     jlist = firstneigh[i];
     jnum = numneigh[i];
 
+    // hoist coeff rows for atom i's type
+    // the row pointers cannot be kept in registers across the j loop
+    //   otherwise, since the compiler must assume the f stores alias them
+
+    const double * const cutsq_i = cutsq[itype];
+    const double * const lj1_i = lj1[itype];
+    const double * const lj2_i = lj2[itype];
+    const double * const lj3_i = lj3[itype];
+    const double * const lj4_i = lj4[itype];
+    const double * const offset_i = offset[itype];
+
     for (jj = 0; jj < jnum; jj++) {
       j = jlist[jj];
       factor_lj = special_lj[sbmask(j)];
       j &= NEIGHMASK;
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
+      delx = xtmp - xc[j][0];
+      dely = ytmp - xc[j][1];
+      delz = ztmp - xc[j][2];
       rsq = delx*delx + dely*dely + delz*delz;
       jtype = type[j];
 
-      if (rsq < cutsq[itype][jtype]) {
+      if (rsq < cutsq_i[jtype]) {
         r2inv = 1.0/rsq;
         r6inv = r2inv*r2inv*r2inv;
-        forcelj = r6inv * (lj1[itype][jtype]*r6inv - lj2[itype][jtype]);
+        forcelj = r6inv * (lj1_i[jtype]*r6inv - lj2_i[jtype]);
         fpair = factor_lj*forcelj*r2inv;
 
         f[i][0] += delx*fpair;
         f[i][1] += dely*fpair;
         f[i][2] += delz*fpair;
-        if (newton_pair || j < nlocal) {
+        if (NEWTON_PAIR || j < nlocal) {
           f[j][0] -= delx*fpair;
           f[j][1] -= dely*fpair;
           f[j][2] -= delz*fpair;
         }
 
-        if (eflag) {
-          evdwl = r6inv*(lj3[itype][jtype]*r6inv-lj4[itype][jtype]) -
-            offset[itype][jtype];
+        if (EFLAG) {
+          evdwl = r6inv*(lj3_i[jtype]*r6inv-lj4_i[jtype]) -
+            offset_i[jtype];
           evdwl *= factor_lj;
         }
 
-        if (evflag) ev_tally(i,j,nlocal,newton_pair,
+        if (EVFLAG) ev_tally(i,j,nlocal,NEWTON_PAIR,
                              evdwl,0.0,fpair,delx,dely,delz);
       }
     }
   }
-
-  if (vflag_fdotr) virial_fdotr_compute();
 }
 
 /* ---------------------------------------------------------------------- */
@@ -53,7 +53,15 @@ class PairLJCut : public Pair {
   double **lj1,**lj2,**lj3,**lj4,**offset;
   double *cut_respa;
 
+#ifdef LMP_MIXED_PREC
+  float **x_single;            // single-precision copy of atom coords
+  int nmax_single;
+#endif
+
   virtual void allocate();
+
+ private:
+  template <int EVFLAG, int EFLAG, int NEWTON_PAIR> void eval();
 };
 
 }
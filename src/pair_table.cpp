@@ -40,6 +40,12 @@ PairTable::PairTable(LAMMPS *lmp) : Pair(lmp)
 {
   ntables = 0;
   tables = NULL;
+
+  nvecmax = 0;
+  vecj = NULL;
+  vecdx = vecdy = vecdz = NULL;
+  vecfrac = vecfac = veccoeff = NULL;
+  vecf = vece = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -51,6 +57,16 @@ PairTable::~PairTable()
   for (int m = 0; m < ntables; m++) free_table(&tables[m]);
   memory->sfree(tables);
 
+  memory->destroy(vecj);
+  memory->destroy(vecdx);
+  memory->destroy(vecdy);
+  memory->destroy(vecdz);
+  memory->destroy(vecfrac);
+  memory->destroy(vecfac);
+  memory->destroy(veccoeff);
+  memory->destroy(vecf);
+  memory->destroy(vece);
+
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
@@ -62,6 +78,11 @@ PairTable::~PairTable()
 
 void PairTable::compute(int eflag, int vflag)
 {
+  if (tabstyle == VECTOR) {
+    compute_vector(eflag,vflag);
+    return;
+  }
+
   int i,j,ii,jj,inum,jnum,itype,jtype,itable;
   double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
   double rsq,factor_lj,fraction,value,a,b;
@@ -188,6 +209,144 @@ void PairTable::compute(int eflag, int vflag)
   if (vflag_fdotr) virial_fdotr_compute();
 }
 
+/* ----------------------------------------------------------------------
+   compute for the vector table style
+   pairs within the cutoff are buffered per atom along with their packed
+     {f,df,e,de} coefficient block, then interpolated in a branch-free
+     pass that compilers auto-vectorize, then accumulated
+   one contiguous 32-byte block replaces 4 strided loads per pair
+------------------------------------------------------------------------- */
+
+void PairTable::compute_vector(int eflag, int vflag)
+{
+  int i,j,ii,jj,m,n,inum,jnum,itype,jtype,itable;
+  double xtmp,ytmp,ztmp,delx,dely,delz,fpair;
+  double rsq,factor_lj;
+  char estr[128];
+  int *ilist,*jlist,*numneigh,**firstneigh;
+  Table *tb;
+
+  int tlm1 = tablength - 1;
+
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else evflag = vflag_fdotr = 0;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+  int newton_pair = force->newton_pair;
+
+  inum = list->inum;
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  // loop over neighbors of my atoms
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    itype = type[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    if (jnum > nvecmax) grow_vector(jnum);
+
+    // pass 1: cutoff test, bin lookup, gather coefficient blocks
+
+    n = 0;
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      factor_lj = special_lj[sbmask(j)];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      jtype = type[j];
+
+      if (rsq >= cutsq[itype][jtype]) continue;
+
+      tb = &tables[tabindex[itype][jtype]];
+      if (rsq < tb->innersq) {
+        sprintf(estr,"Pair distance < table inner cutoff: "
+                "ijtype %d %d dist %g",itype,jtype,sqrt(rsq));
+        error->one(FLERR,estr);
+      }
+      itable = static_cast<int> ((rsq - tb->innersq) * tb->invdelta);
+      if (itable >= tlm1) {
+        sprintf(estr,"Pair distance > table outer cutoff: "
+                "ijtype %d %d dist %g",itype,jtype,sqrt(rsq));
+        error->one(FLERR,estr);
+      }
+
+      const double *c = &tb->c4[4*itable];
+      vecj[n] = j;
+      vecdx[n] = delx;
+      vecdy[n] = dely;
+      vecdz[n] = delz;
+      vecfrac[n] = (rsq - (tb->innersq + itable*tb->delta)) * tb->invdelta;
+      vecfac[n] = factor_lj;
+      veccoeff[4*n] = c[0];
+      veccoeff[4*n+1] = c[1];
+      veccoeff[4*n+2] = c[2];
+      veccoeff[4*n+3] = c[3];
+      n++;
+    }
+
+    // pass 2: branch-free interpolation, energies are cheap enough
+    //   to always compute and keep the loop body uniform
+
+    for (m = 0; m < n; m++) {
+      vecf[m] = vecfac[m] * (veccoeff[4*m] + vecfrac[m]*veccoeff[4*m+1]);
+      vece[m] = vecfac[m] * (veccoeff[4*m+2] + vecfrac[m]*veccoeff[4*m+3]);
+    }
+
+    // pass 3: accumulate forces and tally
+
+    for (m = 0; m < n; m++) {
+      j = vecj[m];
+      fpair = vecf[m];
+      f[i][0] += vecdx[m]*fpair;
+      f[i][1] += vecdy[m]*fpair;
+      f[i][2] += vecdz[m]*fpair;
+      if (newton_pair || j < nlocal) {
+        f[j][0] -= vecdx[m]*fpair;
+        f[j][1] -= vecdy[m]*fpair;
+        f[j][2] -= vecdz[m]*fpair;
+      }
+
+      if (evflag) ev_tally(i,j,nlocal,newton_pair,
+                           vece[m],0.0,fpair,vecdx[m],vecdy[m],vecdz[m]);
+    }
+  }
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+/* ----------------------------------------------------------------------
+   grow per-atom pair buffers for the vector table style
+------------------------------------------------------------------------- */
+
+void PairTable::grow_vector(int n)
+{
+  nvecmax = n;
+  memory->grow(vecj,nvecmax,"pair:vecj");
+  memory->grow(vecdx,nvecmax,"pair:vecdx");
+  memory->grow(vecdy,nvecmax,"pair:vecdy");
+  memory->grow(vecdz,nvecmax,"pair:vecdz");
+  memory->grow(vecfrac,nvecmax,"pair:vecfrac");
+  memory->grow(vecfac,nvecmax,"pair:vecfac");
+  memory->grow(veccoeff,4*nvecmax,"pair:veccoeff");
+  memory->grow(vecf,nvecmax,"pair:vecf");
+  memory->grow(vece,nvecmax,"pair:vece");
+}
+
 /* ----------------------------------------------------------------------
    allocate all arrays
 ------------------------------------------------------------------------- */
@@ -220,6 +379,7 @@ void PairTable::settings(int narg, char **arg)
   else if (strcmp(arg[0],"linear") == 0) tabstyle = LINEAR;
   else if (strcmp(arg[0],"spline") == 0) tabstyle = SPLINE;
   else if (strcmp(arg[0],"bitmap") == 0) tabstyle = BITMAP;
+  else if (strcmp(arg[0],"vector") == 0) tabstyle = VECTOR;
   else error->all(FLERR,"Unknown table style in pair_style command");
 
   tablength = force->inumeric(FLERR,arg[1]);
@@ -647,8 +807,9 @@ void PairTable::compute_table(Table *tb)
   // rsq,e,f are N in length so de,df arrays can compute difference
   // f is converted to f/r when stored in f[i]
   // e,f can match read-in values, else compute via spline interp
+  // vector style builds the same tables, then also packs them
 
-  if (tabstyle == LINEAR) {
+  if (tabstyle == LINEAR || tabstyle == VECTOR) {
     memory->create(tb->rsq,tablength,"pair:rsq");
     memory->create(tb->e,tablength,"pair:e");
     memory->create(tb->f,tablength,"pair:f");
@@ -675,6 +836,20 @@ void PairTable::compute_table(Table *tb)
     }
   }
 
+  // vector tables
+  // c4 packs {f,df,e,de} contiguously per bin so a single cache-line
+  //   load serves the whole interpolation in compute_vector()
+
+  if (tabstyle == VECTOR) {
+    memory->create(tb->c4,4*tlm1,"pair:c4");
+    for (int i = 0; i < tlm1; i++) {
+      tb->c4[4*i] = tb->f[i];
+      tb->c4[4*i+1] = tb->df[i];
+      tb->c4[4*i+2] = tb->e[i];
+      tb->c4[4*i+3] = tb->de[i];
+    }
+  }
+
   // cubic spline tables
   // N-1 evenly spaced bins in rsq from inner to cut
   // rsq,e,f = value at lower edge of bin
@@ -853,6 +1028,7 @@ void PairTable::null_table(Table *tb)
   tb->e2file = tb->f2file = NULL;
   tb->rsq = tb->drsq = tb->e = tb->de = NULL;
   tb->f = tb->df = tb->e2 = tb->f2 = NULL;
+  tb->c4 = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -875,6 +1051,7 @@ void PairTable::free_table(Table *tb)
   memory->destroy(tb->df);
   memory->destroy(tb->e2);
   memory->destroy(tb->f2);
+  memory->destroy(tb->c4);
 }
 
 /* ----------------------------------------------------------------------
@@ -1008,7 +1185,7 @@ double PairTable::single(int /*i*/, int /*j*/, int itype, int jtype, double rsq,
     itable = static_cast<int> ((rsq-tb->innersq) * tb->invdelta);
     if (itable >= tlm1) error->one(FLERR,"Pair distance > table outer cutoff");
     fforce = factor_lj * tb->f[itable];
-  } else if (tabstyle == LINEAR) {
+  } else if (tabstyle == LINEAR || tabstyle == VECTOR) {
     itable = static_cast<int> ((rsq-tb->innersq) * tb->invdelta);
     if (itable >= tlm1) error->one(FLERR,"Pair distance > table outer cutoff");
     fraction = (rsq - tb->rsq[itable]) * tb->invdelta;
@@ -1035,7 +1212,7 @@ double PairTable::single(int /*i*/, int /*j*/, int itype, int jtype, double rsq,
 
   if (tabstyle == LOOKUP)
     phi = tb->e[itable];
-  else if (tabstyle == LINEAR || tabstyle == BITMAP)
+  else if (tabstyle == LINEAR || tabstyle == VECTOR || tabstyle == BITMAP)
     phi = tb->e[itable] + fraction*tb->de[itable];
   else
     phi = a * tb->e[itable] + b * tb->e[itable+1] +
@@ -40,7 +40,7 @@ class PairTable : public Pair {
   virtual double single(int, int, int, int, double, double, double, double &);
   void *extract(const char *, int &);
 
-  enum{LOOKUP,LINEAR,SPLINE,BITMAP};
+  enum{LOOKUP,LINEAR,SPLINE,BITMAP,VECTOR};
 
  protected:
   int tabstyle,tablength;
@@ -52,13 +52,23 @@ class PairTable : public Pair {
     double *e2file,*f2file;
     double innersq,delta,invdelta,deltasq6;
     double *rsq,*drsq,*e,*de,*f,*df,*e2,*f2;
+    double *c4;                 // packed {f,df,e,de} blocks, vector style
   };
   int ntables;
   Table *tables;
 
   int **tabindex;
 
+  int nvecmax;                  // size of vector-style pair buffers
+  int *vecj;                    // buffered neighbor indices
+  double *vecdx,*vecdy,*vecdz;  // buffered pair separations
+  double *vecfrac,*vecfac;      // buffered bin fractions, special factors
+  double *veccoeff;             // buffered coefficient blocks
+  double *vecf,*vece;           // interpolated force, energy per pair
+
   virtual void allocate();
+  void compute_vector(int, int);
+  void grow_vector(int);
   void read_table(Table *, char *, char *);
   void param_extract(Table *, char *);
   void bcast_table(Table *);
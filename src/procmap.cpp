@@ -827,6 +827,14 @@ int ProcMap::cull_other(int n, int **factors, int m,
 /* ----------------------------------------------------------------------
    choose best factors from list of Npossible factors
    best = minimal surface area of sub-domain
+   surface area is the comm-volume proxy, computed for the actual box
+     shape (including triclinic tilt) at the time the grid is created
+   this is a one-shot static choice: the grid is fixed before atoms are
+     distributed, and changing it later would mean a full re-decomposition,
+     so there is no in-run timed probe search
+   when the setup-time shape is not representative (fix deform/npt) the
+     processors command overrides the grid; non-uniform density is the
+     balance commands' job, not the grid's
    return best = 3 factors
    return index of best factors in factors
 ------------------------------------------------------------------------- */
@@ -29,8 +29,6 @@ using namespace LAMMPS_NS;
 void box_merge(void *, void *, int *, MPI_Datatype *);
 void median_merge(void *, void *, int *, MPI_Datatype *);
 
-// NOTE: if want to have reuse flag, need to sum Tree across procs
-
 /* ---------------------------------------------------------------------- */
 
 RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
@@ -50,7 +48,12 @@ RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
   maxrecv = maxsend = 0;
   recvproc = recvindex = sendproc = sendindex = NULL;
 
-  tree = NULL;
+  // tree of cuts is gathered across all procs at the end of compute(),
+  // seeding the median search when the same decomposition is recomputed
+
+  tree = (Tree *) memory->smalloc(nprocs*sizeof(Tree),"RCB:tree");
+  for (int i = 0; i < nprocs; i++) tree[i].dim = -1;
+
   irregular = NULL;
 
   // create MPI data and function types for box and median AllReduce ops
@@ -63,7 +66,10 @@ RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
   MPI_Op_create(box_merge,1,&box_op);
   MPI_Op_create(median_merge,1,&med_op);
 
-  reuse = 0;
+  // reuse previous cuts as starting guesses for the median search
+  // 1st call is unaffected since all tree dims are initialized to -1
+
+  reuse = 1;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -609,6 +615,16 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
     recvproc[i] = dots[i].proc;
     recvindex[i] = dots[i].index;
   }
+
+  // gather cut info from all procs into the tree of cuts
+  // each cut is owned by the procmid proc of the partition it split,
+  //   so entry 0 (owned by no one) keeps dim = -1 and is never matched
+  // next call seeds each median search with the previous cut position
+
+  Tree mytree;
+  mytree.cut = cut;
+  mytree.dim = cutdim;
+  MPI_Allgather(&mytree,sizeof(Tree),MPI_CHAR,tree,sizeof(Tree),MPI_CHAR,world);
 }
 
 /* ----------------------------------------------------------------------
@@ -1101,6 +1117,16 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
     recvproc[i] = dots[i].proc;
     recvindex[i] = dots[i].index;
   }
+
+  // gather cut info from all procs into the tree of cuts
+  // each cut is owned by the procmid proc of the partition it split,
+  //   so entry 0 (owned by no one) keeps dim = -1 and is never matched
+  // next call seeds each median search with the previous cut position
+
+  Tree mytree;
+  mytree.cut = cut;
+  mytree.dim = cutdim;
+  MPI_Allgather(&mytree,sizeof(Tree),MPI_CHAR,tree,sizeof(Tree),MPI_CHAR,world);
 }
 
 /* ----------------------------------------------------------------------
@@ -21,6 +21,11 @@
 #include <cstring>
 #include <cstdlib>
 #include <cctype>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "read_data.h"
 #include "atom.h"
 #include "atom_vec.h"
@@ -81,6 +86,10 @@ ReadData::ReadData(LAMMPS *lmp) : Pointers(lmp)
   arg = NULL;
   fp = NULL;
 
+  mmapflag = 0;
+  mapbase = NULL;
+  mapsize = 0;
+
   // customize for new sections
   // pointers to atom styles that store extra info
 
@@ -721,6 +730,14 @@ void ReadData::command(int narg, char **arg)
     // close file
 
     if (me == 0) {
+#if !defined(_WIN32)
+      if (mmapflag) {
+        munmap(mapbase,mapsize);
+        mapbase = NULL;
+        mapsize = 0;
+        mmapflag = 0;
+      }
+#endif
       if (compressed) pclose(fp);
       else fclose(fp);
       fp = NULL;
@@ -1149,7 +1166,7 @@ void ReadData::atoms()
 
   while (nread < natoms) {
     nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     atom->data_atoms(nchunk,buffer,id_offset,mol_offset,toffset,shiftflag,shift);
     nread += nchunk;
@@ -1207,7 +1224,7 @@ void ReadData::velocities()
 
   while (nread < natoms) {
     nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     atom->data_vels(nchunk,buffer,id_offset);
     nread += nchunk;
@@ -1257,7 +1274,7 @@ void ReadData::bonds(int firstpass)
 
   while (nread < nbonds) {
     nchunk = MIN(nbonds-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     atom->data_bonds(nchunk,buffer,count,id_offset,boffset);
     nread += nchunk;
@@ -1340,7 +1357,7 @@ void ReadData::angles(int firstpass)
 
   while (nread < nangles) {
     nchunk = MIN(nangles-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     atom->data_angles(nchunk,buffer,count,id_offset,aoffset);
     nread += nchunk;
@@ -1423,7 +1440,7 @@ void ReadData::dihedrals(int firstpass)
 
   while (nread < ndihedrals) {
     nchunk = MIN(ndihedrals-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     atom->data_dihedrals(nchunk,buffer,count,id_offset,doffset);
     nread += nchunk;
@@ -1506,7 +1523,7 @@ void ReadData::impropers(int firstpass)
 
   while (nread < nimpropers) {
     nchunk = MIN(nimpropers-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     atom->data_impropers(nchunk,buffer,count,id_offset,ioffset);
     nread += nchunk;
@@ -1577,7 +1594,7 @@ void ReadData::bonus(bigint nbonus, AtomVec *ptr, const char *type)
 
   while (nread < natoms) {
     nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     atom->data_bonus(nchunk,buffer,ptr,id_offset);
     nread += nchunk;
@@ -1884,7 +1901,7 @@ void ReadData::fix(int ifix, char *keyword)
   bigint nread = 0;
   while (nread < nline) {
     nchunk = MIN(nline-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+    eof = read_lines(nchunk);
     if (eof) error->all(FLERR,"Unexpected end of data file");
     modify->fix[ifix]->read_data_section(keyword,nchunk,buffer,id_offset);
     nread += nchunk;
@@ -1937,6 +1954,67 @@ void ReadData::open(char *file)
     sprintf(str,"Cannot open file %s",file);
     error->one(FLERR,str);
   }
+
+  // memory-map an uncompressed file so read_lines() and skip_lines()
+  //   can chunk and skip sections without per-line fgets calls
+
+#if !defined(_WIN32)
+  mmapflag = 0;
+  if (!compressed) {
+    struct stat sb;
+    if (fstat(fileno(fp),&sb) == 0 && sb.st_size > 0) {
+      void *ptr = mmap(NULL,sb.st_size,PROT_READ,MAP_PRIVATE,fileno(fp),0);
+      if (ptr != MAP_FAILED) {
+        mapbase = (char *) ptr;
+        mapsize = sb.st_size;
+        mmapflag = 1;
+      }
+    }
+  }
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   proc 0 reads N lines from file into buffer and bcasts them
+   when the file is memory-mapped the lines are located by scanning for
+     newlines and copied in bulk, avoiding per-line fgets
+   the stdio position is kept in sync for the non-chunked readers
+   returns 1 on EOF, else 0
+------------------------------------------------------------------------- */
+
+int ReadData::read_lines(int n)
+{
+  if (!mmapflag) return comm->read_lines_from_file(fp,n,MAXLINE,buffer);
+
+  int m = 0;
+  if (me == 0) {
+    bigint cursor = ftell(fp);
+    for (int i = 0; i < n; i++) {
+      if (cursor >= mapsize) {
+        m = 0;
+        break;
+      }
+      char *start = &mapbase[cursor];
+      char *eol = (char *) memchr(start,'\n',mapsize-cursor);
+      bigint len;
+      if (eol) len = eol - start + 1;
+      else len = mapsize - cursor;
+      if (len > MAXLINE-1) len = MAXLINE-1;
+      memcpy(&buffer[m],start,len);
+      m += len;
+      cursor += len;
+    }
+    if (m) {
+      if (buffer[m-1] != '\n') buffer[m++] = '\n';
+      buffer[m++] = '\0';
+    }
+    fseek(fp,cursor,SEEK_SET);
+  }
+
+  MPI_Bcast(&m,1,MPI_INT,0,world);
+  if (m == 0) return 1;
+  MPI_Bcast(buffer,m,MPI_CHAR,0,world);
+  return 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -2020,6 +2098,24 @@ void ReadData::skip_lines(bigint n)
 {
   if (me) return;
   if (n <= 0) return;
+
+  // memory-mapped file skips by scanning for newlines,
+  //   deferring all parsing of the skipped section
+
+#if !defined(_WIN32)
+  if (mmapflag) {
+    bigint cursor = ftell(fp);
+    for (bigint i = 0; i < n; i++) {
+      if (cursor >= mapsize) error->one(FLERR,"Unexpected end of data file");
+      char *eol = (char *) memchr(&mapbase[cursor],'\n',mapsize-cursor);
+      if (eol) cursor = eol - mapbase + 1;
+      else cursor = mapsize;
+    }
+    fseek(fp,cursor,SEEK_SET);
+    return;
+  }
+#endif
+
   char *eof = NULL;
   for (bigint i = 0; i < n; i++) eof = fgets(line,MAXLINE,fp);
   if (eof == NULL) error->one(FLERR,"Unexpected end of data file");
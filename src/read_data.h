@@ -35,6 +35,10 @@ class ReadData : protected Pointers {
   int me,compressed;
   char *line,*copy,*keyword,*buffer,*style;
   FILE *fp;
+
+  int mmapflag;              // 1 if data file is memory-mapped on proc 0
+  char *mapbase;             // start of mapped file
+  bigint mapsize;            // length of mapped file
   char **arg;
   int narg,maxarg;
   char argoffset1[8],argoffset2[8];
@@ -80,6 +84,7 @@ class ReadData : protected Pointers {
   // methods
 
   void open(char *);
+  int read_lines(int);
   void scan(int &, int &, int &, int &);
   int reallocate(int **, int, int);
   void header(int);
@@ -72,7 +72,19 @@ enum{VERSION,SMALLINT,TAGINT,BIGINT,
 
 ReadRestart::ReadRestart(LAMMPS *lmp) : Pointers(lmp) {}
 
-/* ---------------------------------------------------------------------- */
+/* ----------------------------------------------------------------------
+   the file is read sequentially and in full: sections carry no table of
+     contents or size prefixes that would allow seeking past them, and
+     per-atom fix state is interleaved into the per-atom chunks by each
+     fix's pack_restart(), so atoms cannot be extracted without walking
+     the fix columns
+   lazy per-section loading would therefore require a new file format,
+     breaking the cross-version compatibility the format guarantees
+   for analysis workflows that only need coordinates, cheaper paths are
+     multiproc ('%') restart files, which all procs read concurrently,
+     the -restart command-line switch converting to a data file in one
+     batch invocation, or dump files plus the rerun command
+------------------------------------------------------------------------- */
 
 void ReadRestart::command(int narg, char **arg)
 {
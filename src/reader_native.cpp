@@ -299,6 +299,13 @@ void ReaderNative::read_atoms(int n, int nfield, double **fields)
   int i,m;
   char *eof;
 
+  // tokenize each line only up to the rightmost requested field
+  // trailing columns the caller did not ask for are never touched
+
+  int nword_use = 0;
+  for (m = 0; m < nfield; m++)
+    nword_use = MAX(nword_use,fieldindex[m]+1);
+
   for (i = 0; i < n; i++) {
     eof = fgets(line,MAXLINE,fp);
     if (eof == NULL) error->one(FLERR,"Unexpected end of dump file");
@@ -306,7 +313,7 @@ void ReaderNative::read_atoms(int n, int nfield, double **fields)
     // tokenize the line
 
     words[0] = strtok(line," \t\n\r\f");
-    for (m = 1; m < nwords; m++)
+    for (m = 1; m < nword_use; m++)
       words[m] = strtok(NULL," \t\n\r\f");
 
     // convert selected fields to floats
@@ -523,6 +523,13 @@ void Replicate::command(int narg, char **arg)
           if (overlap) {
             num_replicas_added++;
 
+            // tag and mol offsets are the same for all atoms in this replica
+
+            if (tag_enable)
+              atom_offset = iz*ny*nx*maxtag + iy*nx*maxtag + ix*maxtag;
+            else atom_offset = 0;
+            mol_offset = iz*ny*nx*maxmol + iy*nx*maxmol + ix*maxmol;
+
             m = 0;
             while (m < size_buf_all) {
               image = ((imageint) IMGMAX << IMG2BITS) |
@@ -549,10 +556,6 @@ void Replicate::command(int narg, char **arg)
                 m += avec->unpack_restart(&buf_all[m]);
 
                 i = atom->nlocal - 1;
-                if (tag_enable)
-                  atom_offset = iz*ny*nx*maxtag + iy*nx*maxtag + ix*maxtag;
-                else atom_offset = 0;
-                mol_offset = iz*ny*nx*maxmol + iy*nx*maxmol + ix*maxmol;
 
                 atom->x[i][0] = x[0];
                 atom->x[i][1] = x[1];
@@ -623,6 +626,13 @@ void Replicate::command(int narg, char **arg)
         for (iy = 0; iy < ny; iy++) {
           for (iz = 0; iz < nz; iz++) {
 
+            // tag and mol offsets are the same for all atoms in this replica
+
+            if (tag_enable)
+              atom_offset = iz*ny*nx*maxtag + iy*nx*maxtag + ix*maxtag;
+            else atom_offset = 0;
+            mol_offset = iz*ny*nx*maxmol + iy*nx*maxmol + ix*maxmol;
+
             // while loop over one proc's atom list
 
             m = 0;
@@ -651,10 +661,6 @@ void Replicate::command(int narg, char **arg)
                 m += avec->unpack_restart(&buf[m]);
 
                 i = atom->nlocal - 1;
-                if (tag_enable)
-                  atom_offset = iz*ny*nx*maxtag + iy*nx*maxtag + ix*maxtag;
-                else atom_offset = 0;
-                mol_offset = iz*ny*nx*maxmol + iy*nx*maxmol + ix*maxmol;
 
                 atom->x[i][0] = x[0];
                 atom->x[i][1] = x[1];
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <cstdlib>
+#include "reset_mol_ids.h"
+#include "atom.h"
+#include "domain.h"
+#include "comm.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+// compare function for qsort() on a vector of molecule IDs
+
+static int tagcompare(const void *pi, const void *pj)
+{
+  tagint i = *((tagint *) pi);
+  tagint j = *((tagint *) pj);
+  if (i < j) return -1;
+  if (i > j) return 1;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+ResetMolIDs::ResetMolIDs(LAMMPS *lmp) : Pointers(lmp) {}
+
+/* ----------------------------------------------------------------------
+   reset molecule IDs to contiguous values 1 to Nmol
+   grouping of atoms into molecules is preserved, only the labels change
+   molecule IDs <= 0 are left alone, consistent with their meaning of
+     "not in a molecule" for other commands
+------------------------------------------------------------------------- */
+
+void ResetMolIDs::command(int narg, char **/*arg*/)
+{
+  if (domain->box_exist == 0)
+    error->all(FLERR,"Reset_mol_ids command before simulation box is defined");
+  if (narg != 0) error->all(FLERR,"Illegal reset_mol_ids command");
+  if (atom->molecule_flag == 0)
+    error->all(FLERR,"Cannot use reset_mol_ids unless atoms have molecule IDs");
+
+  if (comm->me == 0) {
+    if (screen) fprintf(screen,"Resetting molecule IDs ...\n");
+    if (logfile) fprintf(logfile,"Resetting molecule IDs ...\n");
+  }
+
+  // list = sorted unique molecule IDs > 0 of owned atoms
+
+  tagint *molecule = atom->molecule;
+  int nlocal = atom->nlocal;
+
+  tagint *list;
+  memory->create(list,nlocal,"reset_mol_ids:list");
+
+  int n = 0;
+  for (int i = 0; i < nlocal; i++)
+    if (molecule[i] > 0) list[n++] = molecule[i];
+  qsort(list,n,sizeof(tagint),tagcompare);
+
+  int nunique = 0;
+  for (int i = 0; i < n; i++)
+    if (i == 0 || list[i] != list[i-1]) list[nunique++] = list[i];
+
+  // allIDs = sorted unique molecule IDs across all procs
+  // each proc stores the full unique list
+  // its length is the molecule count, which is small relative to natoms
+
+  int nprocs = comm->nprocs;
+
+  int *recvcounts,*displs;
+  memory->create(recvcounts,nprocs,"reset_mol_ids:recvcounts");
+  memory->create(displs,nprocs,"reset_mol_ids:displs");
+
+  MPI_Allgather(&nunique,1,MPI_INT,recvcounts,1,MPI_INT,world);
+  displs[0] = 0;
+  for (int iproc = 1; iproc < nprocs; iproc++)
+    displs[iproc] = displs[iproc-1] + recvcounts[iproc-1];
+  int ntotal = displs[nprocs-1] + recvcounts[nprocs-1];
+
+  tagint *allIDs;
+  memory->create(allIDs,ntotal,"reset_mol_ids:allIDs");
+  MPI_Allgatherv(list,nunique,MPI_LMP_TAGINT,
+                 allIDs,recvcounts,displs,MPI_LMP_TAGINT,world);
+
+  qsort(allIDs,ntotal,sizeof(tagint),tagcompare);
+
+  int nmol = 0;
+  for (int i = 0; i < ntotal; i++)
+    if (i == 0 || allIDs[i] != allIDs[i-1]) allIDs[nmol++] = allIDs[i];
+
+  // new molecule ID = 1-based rank of old ID in allIDs, via binary search
+
+  for (int i = 0; i < nlocal; i++) {
+    if (molecule[i] <= 0) continue;
+    tagint oldID = molecule[i];
+    int lo = 0;
+    int hi = nmol-1;
+    while (lo < hi) {
+      int mid = (lo+hi)/2;
+      if (allIDs[mid] < oldID) lo = mid+1;
+      else hi = mid;
+    }
+    molecule[i] = lo+1;
+  }
+
+  // clean up
+
+  memory->destroy(list);
+  memory->destroy(recvcounts);
+  memory->destroy(displs);
+  memory->destroy(allIDs);
+
+  // print stats
+
+  if (comm->me == 0) {
+    if (screen) fprintf(screen,"  %d molecule IDs, reset to 1 to %d\n",
+                        nmol,nmol);
+    if (logfile) fprintf(logfile,"  %d molecule IDs, reset to 1 to %d\n",
+                         nmol,nmol);
+  }
+}
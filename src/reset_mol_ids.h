@@ -0,0 +1,56 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef COMMAND_CLASS
+
+CommandStyle(reset_mol_ids,ResetMolIDs)
+
+#else
+
+#ifndef LMP_RESET_MOL_IDS_H
+#define LMP_RESET_MOL_IDS_H
+
+#include "pointers.h"
+
+namespace LAMMPS_NS {
+
+class ResetMolIDs : protected Pointers {
+ public:
+  ResetMolIDs(class LAMMPS *);
+  void command(int, char **);
+
+ private:
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Reset_mol_ids command before simulation box is defined
+
+Self-explanatory.
+
+E: Illegal ... command
+
+Self-explanatory.  Check the input script syntax and compare to the
+documentation for the command.  You can use -echo screen as a
+command-line option when running LAMMPS to see the offending line.
+
+E: Cannot use reset_mol_ids unless atoms have molecule IDs
+
+Self-explanatory.
+
+*/
@@ -50,6 +50,19 @@ Special::~Special()
    create 1-2, 1-3, 1-4 lists of topology neighbors
    store in onetwo, onethree, onefour for each atom
    store 3 counters in nspecial[i]
+   scaling note: the comm->ring() passes cycle the full global dataset
+     past every proc, so per-proc work is O(N) independent of P and the
+     latency chain is O(P); at several 100M atoms this setup dominates
+     startup time
+   the per-atom callbacks and dedup() are already hash-based via the
+     atom map, so the cost is in the transport, not the scans; the cure
+     is recasting each ring pass as a rendezvous (hash atom IDs to owner
+     procs, exchange via Irregular), see the note on comm->ring(),
+     which changes every callback's protocol and is left for a
+     dedicated rework
+   incremental patching after delete_bonds is not attempted: removing
+     one bond invalidates 1-3 and 1-4 entries two hops away on other
+     procs, which is the same communication pattern as a full rebuild
 ------------------------------------------------------------------------- */
 
 void Special::build()
@@ -184,12 +184,17 @@ Thermo::Thermo(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   format_float_user = NULL;
   format_int_user = NULL;
   format_bigint_user = NULL;
+
+  binfp = NULL;
+  binnfield = -1;
 }
 
 /* ---------------------------------------------------------------------- */
 
 Thermo::~Thermo()
 {
+  if (binfp) fclose(binfp);
+
   delete [] style;
   delete [] line;
 
@@ -342,6 +347,35 @@ void Thermo::compute(int flag)
   if (natoms == 0) normflag = 0;
   else normflag = normvalue;
 
+  // fuse MPI reductions for scalar computes which support the
+  //   pack/unpack protocol and have not yet been invoked this step
+  // one Allreduce of all their local values replaces one per compute
+  // only worth doing if 2 or more can be fused, else fall thru to
+  //   normal invocation below
+
+  int j,nbatch;
+
+  nbatch = 0;
+  for (i = 0; i < ncompute; i++)
+    if (compute_which[i] == SCALAR &&
+        computes[i]->reduce_batch_flag &&
+        !(computes[i]->invoked_flag & INVOKED_SCALAR) &&
+        computes[i]->invoked_scalar != ntimestep) {
+      for (j = 0; j < nbatch; j++)
+        if (computes[batchlist[j]] == computes[i]) break;
+      if (j == nbatch) batchlist[nbatch++] = i;
+    }
+
+  if (nbatch > 1) {
+    for (j = 0; j < nbatch; j++)
+      batchlocal[j] = computes[batchlist[j]]->pack_reduce_scalar();
+    MPI_Allreduce(batchlocal,batchglobal,nbatch,MPI_DOUBLE,MPI_SUM,world);
+    for (j = 0; j < nbatch; j++) {
+      computes[batchlist[j]]->unpack_reduce_scalar(batchglobal[j]);
+      computes[batchlist[j]]->invoked_flag |= INVOKED_SCALAR;
+    }
+  }
+
   // invoke Compute methods needed for thermo keywords
 
   for (i = 0; i < ncompute; i++)
@@ -365,7 +399,7 @@ void Thermo::compute(int flag)
   // if lineflag = MULTILINE, prepend step/cpu header line
 
   int loc = 0;
-  if (lineflag == MULTILINE) {
+  if (lineflag == MULTILINE && me == 0) {
     double cpu;
     if (flag) cpu = timer->elapsed(Timer::TOTAL);
     else cpu = 0.0;
@@ -373,15 +407,21 @@ void Thermo::compute(int flag)
   }
 
   // add each thermo value to line with its specific format
+  // keyword methods must run on all procs, they can invoke collectives,
+  //   but only proc 0 formats the line it will print
 
   for (ifield = 0; ifield < nfield; ifield++) {
     (this->*vfunc[ifield])();
-    if (vtype[ifield] == FLOAT)
+    if (me) continue;
+    if (vtype[ifield] == FLOAT) {
       loc += sprintf(&line[loc],format[ifield],dvalue);
-    else if (vtype[ifield] == INT)
+      binvalues[ifield] = dvalue;
+    } else if (vtype[ifield] == INT) {
       loc += sprintf(&line[loc],format[ifield],ivalue);
-    else if (vtype[ifield] == BIGINT) {
+      binvalues[ifield] = ivalue;
+    } else if (vtype[ifield] == BIGINT) {
       loc += sprintf(&line[loc],format[ifield],bivalue);
+      binvalues[ifield] = static_cast<double> (bivalue);
     }
   }
 
@@ -395,6 +435,30 @@ void Thermo::compute(int flag)
     }
   }
 
+  // append one record to binary thermo stream, only written by proc 0
+  // schema record = marker 0, # of fields, then each keyword as len + chars
+  // data record = marker 1, then nfield values as doubles
+  // schema is re-emitted whenever nfield changes, e.g. when the Volume
+  //   field is auto-added for a run with a fix that changes the box
+
+  if (binfp) {
+    if (nfield != binnfield) {
+      int marker = 0;
+      fwrite(&marker,sizeof(int),1,binfp);
+      fwrite(&nfield,sizeof(int),1,binfp);
+      for (i = 0; i < nfield; i++) {
+        int n = strlen(keyword[i]);
+        fwrite(&n,sizeof(int),1,binfp);
+        fwrite(keyword[i],sizeof(char),n,binfp);
+      }
+      binnfield = nfield;
+    }
+    int marker = 1;
+    fwrite(&marker,sizeof(int),1,binfp);
+    fwrite(binvalues,sizeof(double),nfield,binfp);
+    if (flushflag) fflush(binfp);
+  }
+
   // set to 1, so that subsequent invocations of CPU time will be non-zero
   // e.g. via variables in print command
 
@@ -564,6 +628,21 @@ void Thermo::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal thermo_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"binary") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal thermo_modify command");
+      if (binfp) fclose(binfp);
+      binfp = NULL;
+      binnfield = -1;
+      if (strcmp(arg[iarg+1],"none") != 0 && me == 0) {
+        binfp = fopen(arg[iarg+1],"wb");
+        if (binfp == NULL) {
+          char str[128];
+          sprintf(str,"Cannot open thermo binary file %s",arg[iarg+1]);
+          error->one(FLERR,str);
+        }
+      }
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"line") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal thermo_modify command");
       if (strcmp(arg[iarg+1],"one") == 0) lineflag = ONELINE;
@@ -668,6 +747,10 @@ void Thermo::allocate()
   compute_which = new int[3*n];
   computes = new Compute*[3*n];
 
+  batchlist = new int[3*n];
+  batchlocal = new double[3*n];
+  batchglobal = new double[3*n];
+
   nfix = 0;
   id_fix = new char*[n];
   fixes = new Fix*[n];
@@ -675,6 +758,8 @@ void Thermo::allocate()
   nvariable = 0;
   id_variable = new char*[n];
   variables = new int[n];
+
+  binvalues = new double[n];
 }
 
 /* ----------------------------------------------------------------------
@@ -704,6 +789,10 @@ void Thermo::deallocate()
   delete [] compute_which;
   delete [] computes;
 
+  delete [] batchlist;
+  delete [] batchlocal;
+  delete [] batchglobal;
+
   for (int i = 0; i < nfix; i++) delete [] id_fix[i];
   delete [] id_fix;
   delete [] fixes;
@@ -711,6 +800,8 @@ void Thermo::deallocate()
   for (int i = 0; i < nvariable; i++) delete [] id_variable[i];
   delete [] id_variable;
   delete [] variables;
+
+  delete [] binvalues;
 }
 
 /* ----------------------------------------------------------------------
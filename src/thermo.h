@@ -70,6 +70,10 @@ class Thermo : protected Pointers {
   int lostbefore;
   int flushflag,lineflag;
 
+  FILE *binfp;           // binary thermo stream, NULL if off
+  int binnfield;         // # of fields in last schema written to stream
+  double *binvalues;     // one row of field values for binary stream
+
   double last_tpcpu,last_spcpu;
   double last_time;
   bigint last_step;
@@ -98,6 +102,10 @@ class Thermo : protected Pointers {
   int *compute_which;          // 0/1/2 if should call scalar,vector,array
   class Compute **computes;    // list of ptrs to the Compute objects
 
+  int *batchlist;              // computes w/ fusable scalar reductions
+  double *batchlocal;          // their local values, packed contiguously
+  double *batchglobal;         // their values after one fused Allreduce
+
   int nfix;                    // # of Fix objects called by thermo
   char **id_fix;               // their IDs
   class Fix **fixes;           // list of ptrs to the Fix objects
@@ -255,6 +263,11 @@ bad dynamics, e.g. atoms have been blown far out of the simulation
 box, or moved further than one processor's sub-domain away before
 reneighboring.
 
+E: Cannot open thermo binary file %s
+
+The output file for binary thermo output cannot be opened.  Check that
+the path and name are correct.
+
 E: Thermo style does not use temp
 
 Cannot use thermo_modify to set this parameter since the thermo_style
@@ -32,6 +32,13 @@
 
 using namespace LAMMPS_NS;
 
+// labels for trace events, indexed by the ttype enum
+
+static const char *timer_name[] =
+  { "Total", "Pair", "Bond", "Kspace", "Neigh", "Comm",
+    "Modify", "Output", "Sync", "Other", "Dephase", "Dynamics",
+    "Quench", "NEB", "Repcomm", "Repout" };
+
 // convert a timespec ([[HH:]MM:]SS) to seconds
 // the strings "off" and "unlimited" result in -1;
 
@@ -99,11 +106,20 @@ Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
   _s_timeout = -1;
   _checkfreq = 10;
   _nextcheck = -1;
+  _tracefp = NULL;
+  _trace_start = 0.0;
   this->_stamp(RESET);
 }
 
 /* ---------------------------------------------------------------------- */
 
+Timer::~Timer()
+{
+  if (_tracefp) fclose(_tracefp);
+}
+
+/* ---------------------------------------------------------------------- */
+
 void Timer::init()
 {
   for (int i = 0; i < NUM_TIMER; i++) {
@@ -129,6 +145,16 @@ void Timer::_stamp(enum ttype which)
     wall_array[which] += delta_wall;
     cpu_array[ALL]    += delta_cpu;
     wall_array[ALL]   += delta_wall;
+
+    // record one complete event per interval in chrome trace format
+    // timestamps and durations are in microseconds
+
+    if (_tracefp)
+      fprintf(_tracefp,
+              "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, \"tid\": 0, "
+              "\"ts\": %.3f, \"dur\": %.3f},\n",
+              timer_name[which],comm->me,
+              1.0e6*(previous_wall - _trace_start),1.0e6*delta_wall);
   }
 
   previous_cpu  = current_cpu;
@@ -307,6 +333,41 @@ void Timer::modify_params(int narg, char **arg)
         if (_checkfreq <= 0)
           error->all(FLERR,"Illegal timers command");
       } else error->all(FLERR,"Illegal timers command");
+    } else if (strcmp(arg[iarg],"trace") == 0) {
+      ++iarg;
+      if (iarg < narg) {
+        if (_tracefp) {
+          fclose(_tracefp);
+          _tracefp = NULL;
+        }
+        if (strcmp(arg[iarg],"off") != 0) {
+
+          // each rank opens its own file, '%' is replaced by the rank
+
+          char *ptr = strchr(arg[iarg],'%');
+          if (!ptr && comm->nprocs > 1)
+            error->all(FLERR,"Timer trace file requires a '%' character "
+                       "for parallel runs");
+          char *fname = new char[strlen(arg[iarg]) + 16];
+          if (ptr) {
+            *ptr = '\0';
+            sprintf(fname,"%s%d%s",arg[iarg],comm->me,ptr+1);
+            *ptr = '%';
+          } else strcpy(fname,arg[iarg]);
+          _tracefp = fopen(fname,"w");
+          if (_tracefp == NULL)
+            error->one(FLERR,"Cannot open timer trace file");
+          delete [] fname;
+
+          // JSON array format: viewers accept a missing closing bracket,
+          // so the file stays loadable if the run is killed
+
+          fprintf(_tracefp,"[\n{\"name\": \"process_name\", \"ph\": \"M\", "
+                  "\"pid\": %d, \"args\": {\"name\": \"MPI rank %d\"}},\n",
+                  comm->me,comm->me);
+          _trace_start = MPI_Wtime();
+        }
+      } else error->all(FLERR,"Illegal timers command");
     } else error->all(FLERR,"Illegal timers command");
     ++iarg;
   }
@@ -28,7 +28,7 @@ class Timer : protected Pointers {
   enum tlevel {OFF=0,LOOP,NORMAL,FULL};
 
   Timer(class LAMMPS *);
-  ~Timer() {};
+  ~Timer();
   void init();
 
   // inline function to reduce overhead if we want no detailed timings
@@ -91,6 +91,8 @@ class Timer : protected Pointers {
   double previous_cpu;
   double previous_wall;
   double timeout_start;
+  FILE *_tracefp;      // per-rank chrome trace file, NULL if tracing off
+  double _trace_start; // wall time origin for trace timestamps
   int _level;     // level of detail: off=0,loop=1,normal=2,full=3
   int _sync;      // if nonzero, synchronize tasks before setting the timer
   int _timeout;   // max allowed wall time in seconds. infinity if negative
@@ -121,4 +123,15 @@ Self-explanatory.  Check the input script syntax and compare to the
 documentation for the command.  You can use -echo screen as a
 command-line option when running LAMMPS to see the offending line.
 
+E: Timer trace file requires a '%' character for parallel runs
+
+Each MPI rank writes its own trace file, so the file name must
+contain a '%' character which is replaced by the rank, unless the
+simulation runs on a single processor.
+
+E: Cannot open timer trace file
+
+The file used for writing trace events could not be opened.  Check
+that the path exists and is writable.
+
 */
@@ -93,9 +93,12 @@ Variable::Variable(LAMMPS *lmp) : Pointers(lmp)
   reader = NULL;
   data = NULL;
   dvalue = NULL;
+  eqvalue = NULL;
+  eqstep = NULL;
   vecs = NULL;
 
   eval_in_progress = NULL;
+  eval_cacheable = 1;
 
   randomequal = NULL;
   randomatom = NULL;
@@ -133,6 +136,8 @@ Variable::~Variable()
   memory->sfree(reader);
   memory->sfree(data);
   memory->sfree(dvalue);
+  memory->destroy(eqvalue);
+  memory->destroy(eqstep);
   memory->sfree(vecs);
 
   memory->destroy(eval_in_progress);
@@ -401,10 +406,12 @@ void Variable::set(int narg, char **arg)
         error->all(FLERR,"Cannot redefine variable as a different style");
       delete [] data[ivar][0];
       copy(1,&arg[2],data[ivar]);
+      eqstep[ivar] = -1;
       replaceflag = 1;
     } else {
       if (nvar == maxvar) grow();
       style[nvar] = EQUAL;
+      eqstep[nvar] = -1;
       num[nvar] = 2;
       which[nvar] = 0;
       pad[nvar] = 0;
@@ -895,9 +902,11 @@ char *Variable::retrieve(char *name)
     // then the Python class stores the result, query it via long_string()
     char *strlong = python->long_string(ifunc);
     if (strlong) str = strlong;
+    eval_cacheable = 0;
   } else if (style[ivar] == INTERNAL) {
     sprintf(data[ivar][0],"%.15g",dvalue[ivar]);
     str = data[ivar][0];
+    eval_cacheable = 0;
   } else if (style[ivar] == ATOM || style[ivar] == ATOMFILE ||
              style[ivar] == VECTOR) return NULL;
 
@@ -915,22 +924,51 @@ char *Variable::retrieve(char *name)
 
 double Variable::compute_equal(int ivar)
 {
+  // return cached value if already evaluated on this timestep of a run
+  // cache is bypassed between runs, where commands can change
+  //   the inputs of a formula without advancing the timestep
+
+  if (style[ivar] == EQUAL && update->whichflag &&
+      eqstep[ivar] == update->ntimestep) return eqvalue[ivar];
+
   if (eval_in_progress[ivar])
     print_var_error(FLERR,"Variable has a circular dependency",ivar);
 
   eval_in_progress[ivar] = 1;
 
+  // eval_cacheable is cleared by evaluate() if the formula contains a
+  //   term that can vary within one timestep (random numbers, CPU time)
+  // combine with the caller state so a nested non-cacheable variable
+  //   also inhibits caching of its parent
+
+  int cacheable_caller = eval_cacheable;
+  eval_cacheable = 1;
+
   double value = 0.0;
-  if (style[ivar] == EQUAL) value = evaluate(data[ivar][0],NULL,ivar);
-  else if (style[ivar] == INTERNAL) value = dvalue[ivar];
-  else if (style[ivar] == PYTHON) {
+  if (style[ivar] == EQUAL) {
+    value = evaluate(data[ivar][0],NULL,ivar);
+    if (eval_cacheable && update->whichflag) {
+      eqvalue[ivar] = value;
+      eqstep[ivar] = update->ntimestep;
+    }
+
+  // internal and python values can be reset within a timestep,
+  //   so they also make any parent formula non-cacheable
+
+  } else if (style[ivar] == INTERNAL) {
+    value = dvalue[ivar];
+    eval_cacheable = 0;
+
+  } else if (style[ivar] == PYTHON) {
     int ifunc = python->find(data[ivar][0]);
     if (ifunc < 0)
       print_var_error(FLERR,"Python variable has no function",ivar);
     python->invoke_function(ifunc,data[ivar][1]);
     value = atof(data[ivar][1]);
+    eval_cacheable = 0;
   }
 
+  eval_cacheable = eval_cacheable && cacheable_caller;
   eval_in_progress[ivar] = 0;
   return value;
 }
@@ -980,7 +1018,45 @@ void Variable::compute_atom(int ivar, int igroup,
   int nlocal = atom->nlocal;
 
   if (style[ivar] == ATOM) {
-    if (sumflag == 0) {
+
+    // fast paths when collapse_tree() reduced the tree to a leaf,
+    //   common for variables of constants or one per-atom quantity
+    // skips the per-atom recursion through eval_tree()
+
+    if (tree->type == VALUE) {
+      double value = tree->value;
+      int m = 0;
+      if (sumflag == 0) {
+        for (int i = 0; i < nlocal; i++) {
+          if (mask[i] & groupbit) result[m] = value;
+          else result[m] = 0.0;
+          m += stride;
+        }
+      } else {
+        for (int i = 0; i < nlocal; i++) {
+          if (mask[i] & groupbit) result[m] += value;
+          m += stride;
+        }
+      }
+
+    } else if (tree->type == ATOMARRAY) {
+      double *array = tree->array;
+      int nstride = tree->nstride;
+      int m = 0;
+      if (sumflag == 0) {
+        for (int i = 0; i < nlocal; i++) {
+          if (mask[i] & groupbit) result[m] = array[i*nstride];
+          else result[m] = 0.0;
+          m += stride;
+        }
+      } else {
+        for (int i = 0; i < nlocal; i++) {
+          if (mask[i] & groupbit) result[m] += array[i*nstride];
+          m += stride;
+        }
+      }
+
+    } else if (sumflag == 0) {
       int m = 0;
       for (int i = 0; i < nlocal; i++) {
         if (mask[i] & groupbit) result[m] = eval_tree(tree,i);
@@ -1100,6 +1176,8 @@ void Variable::remove(int n)
     pad[i-1] = pad[i];
     reader[i-1] = reader[i];
     data[i-1] = data[i];
+    eqvalue[i-1] = eqvalue[i];
+    eqstep[i-1] = eqstep[i];
   }
   nvar--;
 }
@@ -1125,6 +1203,10 @@ void Variable::grow()
   data = (char ***) memory->srealloc(data,maxvar*sizeof(char **),"var:data");
   memory->grow(dvalue,maxvar,"var:dvalue");
 
+  memory->grow(eqvalue,maxvar,"var:eqvalue");
+  memory->grow(eqstep,maxvar,"var:eqstep");
+  for (int i = old; i < maxvar; i++) eqstep[i] = -1;
+
   vecs = (VecVar *) memory->srealloc(vecs,maxvar*sizeof(VecVar),"var:vecvar");
   for (int i = old; i < maxvar; i++) {
     vecs[i].nmax = 0;
@@ -1602,6 +1684,12 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         }
         Fix *fix = modify->fix[ifix];
 
+        // fix outputs can change between evaluations within one
+        //   timestep, e.g. from an end_of_step() call, so the
+        //   enclosing formula cannot be cached
+
+        eval_cacheable = 0;
+
         // parse zero or one or two trailing brackets
         // point i beyond last bracket
         // nbracket = # of bracket pairs
@@ -1871,10 +1959,13 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
 
         // v_name = scalar from internal-style variable
         // access value directly
+        // internal values can be reset within a timestep, so the
+        //   enclosing formula cannot be cached
 
         if (nbracket == 0 && style[ivar] == INTERNAL) {
 
           value1 = dvalue[ivar];
+          eval_cacheable = 0;
           if (tree) {
             Tree *newtree = new Tree();
             newtree->type = VALUE;
@@ -2089,6 +2180,12 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
             print_var_error(FLERR,"Variable evaluation before "
                             "simulation box is defined",ivar);
 
+          // wall-clock based keywords change within a timestep
+
+          if (strcmp(word,"cpu") == 0 || strcmp(word,"tpcpu") == 0 ||
+              strcmp(word,"spcpu") == 0 || strcmp(word,"cpuremain") == 0)
+            eval_cacheable = 0;
+
           int flag = output->thermo->evaluate_keyword(word,&value1);
           if (flag) {
             char msg[128];
@@ -3454,6 +3551,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
   } else if (strcmp(word,"random") == 0) {
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
+    eval_cacheable = 0;
     if (tree) newtree->type = RANDOM;
     else {
       if (randomequal == NULL) {
@@ -3467,6 +3565,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
   } else if (strcmp(word,"normal") == 0) {
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
+    eval_cacheable = 0;
     if (tree) newtree->type = NORMAL;
     else {
       if (value2 < 0.0)
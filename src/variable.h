@@ -63,6 +63,9 @@ class Variable : protected Pointers {
   char ***data;            // str value of each variable's values
   double *dvalue;          // single numeric value for internal variables
 
+  double *eqvalue;         // cached value of each equal-style variable
+  bigint *eqstep;          // timestep eqvalue was computed on, -1 if never
+
   struct VecVar {
     int n,nmax;
     bigint currentstep;
@@ -71,6 +74,8 @@ class Variable : protected Pointers {
   VecVar *vecs;
 
   int *eval_in_progress;       // flag if evaluation of variable is in progress
+  int eval_cacheable;          // 0 if current evaluation encountered a term
+                               //   that can vary within one timestep
   int treetype;                // ATOM or VECTOR flag for formula evaluation
 
   class RanMars *randomequal;   // random number generator for equal-style vars
@@ -34,6 +34,10 @@
 #include "memory.h"
 #include "error.h"
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
@@ -296,6 +300,10 @@ void Verlet::run(int n)
     // important for pair to come before bonded contributions
     // since some bonded potentials tally pairwise energy/virial
     // and Pair:ev_tally() needs to be called before any tallying
+    // bonded terms stay separate sweeps by design: they walk per-bond
+    //   topology lists, not the pair list (1-2/1-3/1-4 partners may be
+    //   excluded from it entirely via special_bonds 0.0), so there is
+    //   no shared traversal to fuse them into
 
     force_clear();
 
@@ -306,22 +314,56 @@ void Verlet::run(int n)
       timer->stamp(Timer::MODIFY);
     }
 
-    if (pair_compute_flag) {
-      force->pair->compute(eflag,vflag);
-      timer->stamp(Timer::PAIR);
-    }
+    // pipelined mode runs kspace->compute() on the main thread (which
+    // owns all MPI calls) concurrently with the pair + bonded terms on a
+    // helper thread; kspace forces go to a buffer merged after the join
+
+    int kspace_pipeline = 0;
+#if defined(_OPENMP)
+    if (kspace_compute_flag && pair_compute_flag &&
+        force->kspace->pipeline_flag && force->kspace->pipeline_capable &&
+        comm->nthreads > 1) kspace_pipeline = 1;
+#endif
+
+    if (kspace_pipeline) {
+#if defined(_OPENMP)
+      force->kspace->pipeline_prepare();
+#pragma omp parallel num_threads(2)
+      {
+        if (omp_get_thread_num() == 0) {
+          force->kspace->compute(eflag,vflag);
+        } else {
+          force->pair->compute(eflag,vflag);
+          if (atom->molecular) {
+            if (force->bond) force->bond->compute(eflag,vflag);
+            if (force->angle) force->angle->compute(eflag,vflag);
+            if (force->dihedral) force->dihedral->compute(eflag,vflag);
+            if (force->improper) force->improper->compute(eflag,vflag);
+          }
+        }
+      }
+      force->kspace->pipeline_merge();
+      timer->stamp(Timer::KSPACE);
+#endif
 
-    if (atom->molecular) {
-      if (force->bond) force->bond->compute(eflag,vflag);
-      if (force->angle) force->angle->compute(eflag,vflag);
-      if (force->dihedral) force->dihedral->compute(eflag,vflag);
-      if (force->improper) force->improper->compute(eflag,vflag);
-      timer->stamp(Timer::BOND);
-    }
+    } else {
+      if (pair_compute_flag) {
+        force->pair->compute(eflag,vflag);
+        timer->stamp(Timer::PAIR);
+      }
 
-    if (kspace_compute_flag) {
-      force->kspace->compute(eflag,vflag);
-      timer->stamp(Timer::KSPACE);
+      if (atom->molecular) {
+        if (force->bond) force->bond->compute(eflag,vflag);
+        if (force->angle) force->angle->compute(eflag,vflag);
+        if (force->dihedral) force->dihedral->compute(eflag,vflag);
+        if (force->improper) force->improper->compute(eflag,vflag);
+        timer->stamp(Timer::BOND);
+      }
+
+      if (kspace_compute_flag) {
+        force->kspace->compute(eflag,vflag);
+        timer->stamp(Timer::KSPACE);
+      }
     }
 
     if (n_pre_reverse) {
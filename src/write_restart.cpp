@@ -416,24 +416,45 @@ void WriteRestart::write(char *file)
   // else wait for ping from fileproc, send my data to fileproc
 
   else {
-    int tmp,recv_size;
+    int tmp,recv_size,next_size;
 
     if (filewriter) {
       MPI_Status status;
       MPI_Request request;
+
+      // double-buffered gather: the receive of the next proc's data is
+      //   posted before the current data is written, so the aggregator
+      //   overlaps MPI communication with file I/O
+
+      double *buf2,*wbuf,*rbuf,*swap;
+      memory->create(buf2,max_size,"write_restart:buf2");
+      wbuf = buf;
+      rbuf = buf2;
+
+      int pending = 0;
+      recv_size = send_size;
       for (int iproc = 0; iproc < nclusterprocs; iproc++) {
-        if (iproc) {
-          MPI_Irecv(buf,max_size,MPI_DOUBLE,me+iproc,0,world,&request);
-          MPI_Send(&tmp,0,MPI_INT,me+iproc,0,world);
-          MPI_Wait(&request,&status);
-          MPI_Get_count(&status,MPI_DOUBLE,&recv_size);
-        } else recv_size = send_size;
+        if (iproc+1 < nclusterprocs) {
+          MPI_Irecv(rbuf,max_size,MPI_DOUBLE,me+iproc+1,0,world,&request);
+          MPI_Send(&tmp,0,MPI_INT,me+iproc+1,0,world);
+          pending = 1;
+        }
 
-        write_double_vec(PERPROC,recv_size,buf);
+        write_double_vec(PERPROC,recv_size,wbuf);
+
+        if (pending) {
+          MPI_Wait(&request,&status);
+          MPI_Get_count(&status,MPI_DOUBLE,&next_size);
+          recv_size = next_size;
+          swap = wbuf; wbuf = rbuf; rbuf = swap;
+          pending = 0;
+        }
       }
       fclose(fp);
       fp = NULL;
 
+      memory->destroy(buf2);
+
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
       MPI_Rsend(buf,send_size,MPI_DOUBLE,fileproc,0,world);
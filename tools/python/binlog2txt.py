@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+
+# Script:  binlog2txt.py
+# Purpose: extract thermo info from a LAMMPS binary thermo file,
+#          written via the thermo_modify binary command,
+#          create a text file of numbers in columns, suitable for plotting
+# Syntax:  binlog2txt.py thermo.bin data.txt X Y ...
+#          thermo.bin = LAMMPS binary thermo file
+#          data.txt = text file to create
+#          X Y ... = columns to include (optional), X,Y are thermo keywords
+#                    if no columns listed, all columns are included
+#
+# format of the binary file, all values in native endianness:
+#   sequence of records, each starting with a 4-byte int marker
+#   marker 0 = schema record: int # of fields, then for each field
+#              an int length followed by that many keyword chars
+#   marker 1 = data record: one 8-byte double per field of last schema
+# a new schema record is written whenever the set of fields changes,
+# e.g. between runs or when the Volume field is auto-added
+
+import sys,struct
+
+if len(sys.argv) < 3:
+  sys.exit("Syntax: binlog2txt.py thermo.bin data.txt X Y ...")
+
+binfile = sys.argv[1]
+datafile = sys.argv[2]
+columns = sys.argv[3:]
+
+f = open(binfile,"rb")
+out = open(datafile,"w")
+
+def readint(f):
+  str = f.read(4)
+  if len(str) < 4: return None
+  return struct.unpack("i",str)[0]
+
+keywords = []
+oldkeywords = None
+
+while 1:
+  marker = readint(f)
+  if marker == None: break
+
+  if marker == 0:
+    nfield = readint(f)
+    keywords = []
+    for i in range(nfield):
+      n = readint(f)
+      keywords.append(f.read(n).decode())
+    if keywords != oldkeywords:
+      if columns:
+        for word in columns:
+          if word not in keywords:
+            sys.exit("Column %s not a keyword in schema: %s" %
+                     (word," ".join(keywords)))
+        out.write("# " + " ".join(columns) + "\n")
+      else:
+        out.write("# " + " ".join(keywords) + "\n")
+      oldkeywords = keywords
+
+  elif marker == 1:
+    str = f.read(8*len(keywords))
+    if len(str) < 8*len(keywords): break
+    values = struct.unpack("%dd" % len(keywords),str)
+    if columns:
+      values = [values[keywords.index(word)] for word in columns]
+    out.write(" ".join(["%g" % v for v in values]) + "\n")
+
+  else:
+    sys.exit("Unrecognized record marker %d - file corrupt?" % marker)
+
+f.close()
+out.close()
@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+
+# Script:  scaling.py
+# Purpose: analyze strong scaling of a LAMMPS run from a set of log files
+#          for the same input run on different processor counts
+#          fits serial/parallel time fractions (Amdahl's law) to the total
+#          loop time and to each section of the MPI task timing breakdown
+#          and reports which section limits the scaling
+# Syntax:  scaling.py log1 log2 log3 ...
+#          log1,log2,... = LAMMPS log files for the same input,
+#                          each run on a different # of procs
+#          or
+#          scaling.py -run "command" -np P1,P2,...
+#          command = command to launch one run, with %d where the
+#                    processor count goes, e.g.
+#                    "mpirun -np %d lmp_mpi -in in.lj"
+#          P1,P2,... = processor counts to run, e.g. 1,2,4,8
+#          run mode launches one run per count, writing log.scaling.P,
+#          then analyzes those logs
+#          at least 2 different processor counts are needed for the fit
+
+import sys,os
+
+# parse_log = extract loop time, proc count, and avg time per section
+#   from the last timing breakdown in a LAMMPS log file
+
+def parse_log(file):
+  ptime = None
+  sections = {}
+  lines = open(file,"r").readlines()
+  i = 0
+  while i < len(lines):
+    words = lines[i].split()
+    if len(words) >= 6 and words[0] == "Loop" and words[1] == "time":
+      ptime = float(words[3])
+      nprocs = int(words[5])
+      sections = {}
+    if lines[i].startswith("MPI task timing breakdown"):
+      i += 2
+      while i+1 < len(lines) and '|' in lines[i+1]:
+        i += 1
+        fields = lines[i].split('|')
+        if len(fields) < 3: continue
+        name = fields[0].strip()
+        sections[name] = float(fields[2])
+    i += 1
+  if ptime == None:
+    raise StandardError, "no 'Loop time' line found in %s" % file
+  return nprocs,ptime,sections
+
+# amdahl = least-squares fit of t(P) = s + p/P
+#   returns serial time s and perfectly-parallel time p
+
+def amdahl(procs,times):
+  n = len(procs)
+  sx = sy = sxx = sxy = 0.0
+  for i in range(n):
+    x = 1.0/procs[i]
+    sx += x
+    sy += times[i]
+    sxx += x*x
+    sxy += x*times[i]
+  p = (n*sxy - sx*sy) / (n*sxx - sx*sx)
+  s = (sy - p*sx) / n
+  return s,p
+
+# main script
+
+args = sys.argv[1:]
+
+if len(args) >= 1 and args[0] == "-run":
+  if len(args) != 4 or args[2] != "-np":
+    raise StandardError, \
+      'Syntax: scaling.py -run "command" -np P1,P2,...'
+  cmd = args[1]
+  counts = [int(one) for one in args[3].split(',')]
+  files = []
+  for np in counts:
+    file = "log.scaling.%d" % np
+    print "running on %d procs ..." % np
+    flag = os.system(cmd % np + " -log %s" % file)
+    if flag: raise StandardError, "run on %d procs failed" % np
+    files.append(file)
+else:
+  files = args
+
+if len(files) < 2:
+  raise StandardError, "Syntax: scaling.py log1 log2 log3 ..."
+
+runs = [parse_log(file) for file in files]
+runs.sort()
+procs = [run[0] for run in runs]
+if len(set(procs)) != len(procs):
+  raise StandardError, "two log files have the same processor count"
+
+# fit total loop time and each section that appears in every log
+
+names = [name for name in runs[0][2] if
+         len([run for run in runs if name in run[2]]) == len(runs)]
+pmax = procs[-1]
+
+print "Processor counts:",' '.join(["%d" % np for np in procs])
+print "Loop times:      ",' '.join(["%g" % run[1] for run in runs])
+print
+print "Amdahl fit of t(P) = s + p/P per section (avg times):"
+print
+print "Section |  serial s  | parallel p | ser frac | eff at %d procs" % pmax
+
+results = []
+for name in ["total"] + names:
+  if name == "total": times = [run[1] for run in runs]
+  else: times = [run[2][name] for run in runs]
+  s,p = amdahl(procs,times)
+  frac = s/(s+p)
+  eff = (s+p) / (pmax*(s+p/pmax))
+  print "%-8s| %-10.4g | %-10.4g | %8.4f | %8.4f" % (name,s,p,frac,eff)
+  if name != "total": results.append((s,name))
+
+# bottleneck = section with the largest serial time,
+#   since that term bounds the achievable speedup
+
+results.sort()
+results.reverse()
+s,p = amdahl(procs,[run[1] for run in runs])
+print
+print "Scaling bottleneck: %s (%g secs of serial time)" % \
+      (results[0][1],results[0][0])
+if s > 0.0:
+  print "Max speedup from serial fraction of loop time: %g" % ((s+p)/s)
+else:
+  print "No serial fraction resolved in loop time (superlinear fit)"